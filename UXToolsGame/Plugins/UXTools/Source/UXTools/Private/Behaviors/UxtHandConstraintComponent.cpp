@@ -219,7 +219,7 @@ void UUxtHandConstraintComponent::UpdateConstraint()
 	FVector PalmLocation;
 	if (UpdateTrackedHand(PalmLocation, PalmRotation))
 	{
-		if (UpdateHandBounds(PalmLocation, PalmRotation))
+		if (UpdateHandBounds())
 		{
 			if (UpdateGoal(PalmLocation, PalmRotation))
 			{
@@ -267,8 +267,13 @@ bool UUxtHandConstraintComponent::UpdateTrackedHand(FVector& OutPalmLocation, FQ
 	{
 		if (IsHandUsableForConstraint(TrackedHand))
 		{
-			float PalmRadius;
-			return IUxtHandTracker::Get().GetJointState(TrackedHand, EHandKeypoint::Palm, OutPalmRotation, OutPalmLocation, PalmRadius);
+			const FUxtHandFrame& HandFrame = IUxtHandTracker::Get().GetHandFrame(TrackedHand);
+			if (HandFrame.HasJoints())
+			{
+				OutPalmRotation = HandFrame.GetJointOrientation(EHandKeypoint::Palm);
+				OutPalmLocation = HandFrame.GetJointPosition(EHandKeypoint::Palm);
+				return true;
+			}
 		}
 		return false;
 	};
@@ -298,30 +303,16 @@ bool UUxtHandConstraintComponent::UpdateTrackedHand(FVector& OutPalmLocation, FQ
 	}
 }
 
-bool UUxtHandConstraintComponent::UpdateHandBounds(const FVector& PalmLocation, const FQuat& PalmRotation)
+bool UUxtHandConstraintComponent::UpdateHandBounds()
 {
-	FTransform WorldFromPalm = FTransform(PalmRotation, PalmLocation);
-	FTransform PalmFromWorld = WorldFromPalm.Inverse();
-	HandBounds = FBox(EForceInit::ForceInitToZero);
-
-	for (int i = 0; i < EHandKeypointCount; ++i)
+	const FUxtHandFrame& HandFrame = IUxtHandTracker::Get().GetHandFrame(TrackedHand);
+	if (!HandFrame.HasJoints())
 	{
-		EHandKeypoint Joint = (EHandKeypoint)i;
-
-		FQuat JointRotation;
-		FVector JointLocation;
-		float JointRadius;
-		if (!IUxtHandTracker::Get().GetJointState(TrackedHand, Joint, JointRotation, JointLocation, JointRadius))
-		{
-			continue;
-		}
-
-		// Joint position in palm coordinates
-		FVector LocalLoc = PalmFromWorld.TransformPosition(JointLocation);
-		// Union with box around the joint, using radius for padding
-		HandBounds += FBox(LocalLoc - FVector::OneVector * JointRadius, LocalLoc + FVector::OneVector * JointRadius);
+		HandBounds = FBox(EForceInit::ForceInitToZero);
+		return false;
 	}
 
+	HandBounds = HandFrame.GetBounds();
 	return (bool)HandBounds.IsValid;
 }
 
@@ -12,8 +12,13 @@
 
 namespace
 {
-	bool GetActivationPoint(EControllerHand Hand, EUxtHandConstraintZone Zone, FVector& OutActivationPoint)
+	bool GetActivationPoint(const FUxtHandFrame& HandFrame, EUxtHandConstraintZone Zone, FVector& OutActivationPoint)
 	{
+		if (!HandFrame.HasJoints())
+		{
+			return false;
+		}
+
 		EHandKeypoint ReferenceJoint1 = EHandKeypoint::Palm;
 		EHandKeypoint ReferenceJoint2 = EHandKeypoint::Palm;
 
@@ -43,42 +48,21 @@ namespace
 			checkNoEntry();
 		}
 
-		FVector ReferenceJointLocation1;
-		FVector ReferenceJointLocation2;
-		FQuat Orientation;
-		float Radius;
-		if (!IUxtHandTracker::Get().GetJointState(Hand, ReferenceJoint1, Orientation, ReferenceJointLocation1, Radius) ||
-			!IUxtHandTracker::Get().GetJointState(Hand, ReferenceJoint2, Orientation, ReferenceJointLocation2, Radius))
-		{
-			return false;
-		}
-
-		OutActivationPoint = FMath::Lerp(ReferenceJointLocation1, ReferenceJointLocation2, 0.5f);
+		OutActivationPoint = FMath::Lerp(HandFrame.GetJointPosition(ReferenceJoint1), HandFrame.GetJointPosition(ReferenceJoint2), 0.5f);
 		return true;
 	}
 
 	bool GetHandPlaneAndActivationPoint(EControllerHand Hand, EUxtHandConstraintZone Zone, FPlane& OutHandPlane, FVector& OutActivationPoint)
 	{
-		FVector WristPosition;
-		FVector IndexPosition;
-		FVector LittlePosition;
-		FQuat Orientation;
-		float Radius;
-
-		if (!IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::Wrist, Orientation, WristPosition, Radius) ||
-			!IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexMetacarpal, Orientation, IndexPosition, Radius) ||
-			!IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::LittleMetacarpal, Orientation, LittlePosition, Radius))
-		{
-			return false;
-		}
+		const FUxtHandFrame& HandFrame = IUxtHandTracker::Get().GetHandFrame(Hand);
 
 		FVector ActivationPoint;
-		if (!GetActivationPoint(Hand, Zone, ActivationPoint))
+		if (!GetActivationPoint(HandFrame, Zone, ActivationPoint))
 		{
 			return false;
 		}
 
-		OutHandPlane = FPlane(WristPosition, IndexPosition, LittlePosition);
+		OutHandPlane = HandFrame.GetPalmPlane();
 		OutActivationPoint = FVector::PointPlaneProject(ActivationPoint, OutHandPlane);
 		return true;
 	}
@@ -88,15 +72,14 @@ bool UUxtPalmUpConstraintComponent::IsHandUsableForConstraint(EControllerHand Ne
 {
 	const FTransform HeadPose = UUxtFunctionLibrary::GetHeadPose(GetWorld());
 
-	FQuat PalmRotation;
-	FVector PalmLocation;
-	float PalmRadius;
-	if (!IUxtHandTracker::Get().GetJointState(NewHand, EHandKeypoint::Palm, PalmRotation, PalmLocation, PalmRadius))
+	const FUxtHandFrame& HandFrame = IUxtHandTracker::Get().GetHandFrame(NewHand);
+	if (!HandFrame.HasJoints())
 	{
 		return false;
 	}
 	// Note: Palm Z is normal to the back of the hand, not the inside
-	const FVector PalmUpVector = PalmRotation.GetUpVector();
+	const FVector& PalmLocation = HandFrame.GetJointPosition(EHandKeypoint::Palm);
+	const FVector PalmUpVector = HandFrame.GetPalmUpVector();
 
 	if (!IsPalmUp(HeadPose, PalmLocation, PalmUpVector))
 	{
@@ -104,7 +87,7 @@ bool UUxtPalmUpConstraintComponent::IsHandUsableForConstraint(EControllerHand Ne
 		return false;
 	}
 
-	if (bRequireFlatHand && !IsHandFlat(NewHand, PalmLocation, PalmUpVector))
+	if (bRequireFlatHand && !IsHandFlat(HandFrame))
 	{
 		bGazeTriggered = false;
 		return false;
@@ -135,25 +118,10 @@ bool UUxtPalmUpConstraintComponent::IsPalmUp(const FTransform& HeadPose, const F
 	return CosAngle >= MinCosAngle;
 }
 
-bool UUxtPalmUpConstraintComponent::IsHandFlat(EControllerHand NewHand, const FVector& PalmLocation, const FVector& PalmUpVector) const
+bool UUxtPalmUpConstraintComponent::IsHandFlat(const FUxtHandFrame& HandFrame) const
 {
 	// Test Palm-Index-Ring triangle against palm for measuring flatness
-	FQuat IndexRotation, RingRotation;
-	FVector IndexLocation, RingLocation;
-	float IndexRadius, RingRadius;
-	if (!IUxtHandTracker::Get().GetJointState(NewHand, EHandKeypoint::IndexTip, IndexRotation, IndexLocation, IndexRadius) ||
-		!IUxtHandTracker::Get().GetJointState(NewHand, EHandKeypoint::RingTip, RingRotation, RingLocation, RingRadius))
-	{
-		return false;
-	}
-
-	FVector FingerNormal = FVector::CrossProduct(RingLocation - PalmLocation, IndexLocation - PalmLocation).GetSafeNormal();
-	if (NewHand != EControllerHand::Left)
-	{
-		FingerNormal = -FingerNormal;
-	}
-
-	const float CosFlatAngle = FVector::DotProduct(FingerNormal, PalmUpVector);
+	const float CosFlatAngle = FVector::DotProduct(HandFrame.GetFingerPlaneNormal(), HandFrame.GetPalmUpVector());
 	const float MinCosFlagAngle = FMath::Cos(FMath::DegreesToRadians(MaxFlatHandAngle));
 
 	// Accept the hand if finger angle is within the cone limit
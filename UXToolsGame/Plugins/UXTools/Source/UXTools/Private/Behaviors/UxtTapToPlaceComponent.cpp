@@ -8,6 +8,7 @@
 #include "Engine/World.h"
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtInputSubsystem.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Math/UnrealMathUtility.h"
 #include "Utils/UxtFunctionLibrary.h"
@@ -91,6 +92,18 @@ void UUxtTapToPlaceComponent::EndPlacement()
 	}
 }
 
+void UUxtTapToPlaceComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtTapToPlaceComponent::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 void UUxtTapToPlaceComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -4,6 +4,7 @@
 #include "Controls/UxtBoundsControlComponent.h"
 
 #include "Components/BoxComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Components/MeshComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "Engine/StaticMesh.h"
@@ -12,9 +13,9 @@
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
-#include "Materials/MaterialParameterCollectionInstance.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Utils/UxtMathUtilsFunctionLibrary.h"
+#include "Utils/UxtParameterCollectionSubsystem.h"
 
 #if WITH_EDITORONLY_DATA
 #include "EditorActorFolders.h"
@@ -47,8 +48,8 @@ struct UxtAffordanceInteractionCache
 	/** Initial transform of the grab point (world space) */
 	FTransform InitialGrabPointTransform;
 
-	/** Opposite affordance's primitive. Caching here prevents iterating over the map each frame. */
-	UPrimitiveComponent* OppositeAffordancePrimitive;
+	/** Opposite affordance. Caching here prevents iterating over the map each frame. */
+	const FUxtAffordanceInstance* OppositeAffordance;
 };
 
 namespace
@@ -75,12 +76,18 @@ namespace
 	const TArray<DistanceToScalePair> AffordanceDistToScale =
 		{{200.0f, 2.0f}, {400.0f, 4.0f}, {600.0f, 6.0f}, {800.0f, 8.0f}, {1000.0f, 10.0f}};
 
-	static FName LeftPositionParam("LeftPointerPosition");
-	static FName RightPositionParam("RightPointerPosition");
 	static FName OpacityParam("Opacity");
 	static FName IsFocusedParam("IsFocused");
 	static FName IsActiveParam("IsActive");
 
+	/** Per-instance custom data indices of instanced affordances. */
+	const int32 OpacityCustomDataIndex = 0;
+	const int32 IsFocusedCustomDataIndex = 1;
+	const int32 IsActiveCustomDataIndex = 2;
+	const int32 NumAffordanceCustomData = 3;
+
+	const int32 NumAffordanceKinds = static_cast<int32>(EUxtAffordanceKind::Corner) + 1;
+
 	/** Utility function to get the focused primitive */
 	UPrimitiveComponent* GetFocusedPrimitive(const UUxtNearPointerComponent* NearPointer)
 	{
@@ -98,6 +105,28 @@ namespace
 									   : (PointerData.FarPointer ? GetFocusedPrimitive(PointerData.FarPointer) : nullptr);
 	}
 
+	/** Utility function to get the focused primitive and the focus point on it */
+	UPrimitiveComponent* GetFocusedPrimitive(const UUxtNearPointerComponent* NearPointer, FVector& OutFocusPoint)
+	{
+		FVector Normal;
+		return NearPointer->GetFocusedGrabPrimitive(OutFocusPoint, Normal);
+	}
+
+	/** Utility function to get the focused primitive and the focus point on it */
+	UPrimitiveComponent* GetFocusedPrimitive(const UUxtFarPointerComponent* FarPointer, FVector& OutFocusPoint)
+	{
+		OutFocusPoint = FarPointer->GetHitPoint();
+		return FarPointer->GetHitPrimitive();
+	}
+
+	/** Utility function to get the focused primitive and the focus point on it */
+	UPrimitiveComponent* GetFocusedPrimitive(const FUxtGrabPointerData& PointerData, FVector& OutFocusPoint)
+	{
+		return PointerData.NearPointer
+				   ? GetFocusedPrimitive(PointerData.NearPointer, OutFocusPoint)
+				   : (PointerData.FarPointer ? GetFocusedPrimitive(PointerData.FarPointer, OutFocusPoint) : nullptr);
+	}
+
 	FString GetAffordanceBoundsAsString(FUxtAffordanceConfig AffordanceConfig)
 	{
 		const FVector BoundsLoc = AffordanceConfig.GetBoundsLocation();
@@ -111,9 +140,9 @@ namespace
 	 *  - If !IsFlat, the center of the bounding box.
 	 *  - If IsFlat, the center of the front face (X axis).
 	 */
-	UPrimitiveComponent* GetOppositeAffordance(
-		const TMap<UPrimitiveComponent*, FUxtAffordanceInstance>& PrimitiveAffordanceMap, const FUxtAffordanceConfig& Config,
-		const bool IsFlat = false)
+	const FUxtAffordanceInstance* GetOppositeAffordance(
+		const TMap<UPrimitiveComponent*, FUxtAffordanceInstance>& PrimitiveAffordanceMap,
+		const TArray<FUxtAffordanceInstance>& InstancedAffordances, const FUxtAffordanceConfig& Config, const bool IsFlat = false)
 	{
 		FVector OppositeBounds = -Config.GetBoundsLocation();
 		if (IsFlat)
@@ -125,12 +154,43 @@ namespace
 		{
 			if (AffordancePair.Value.Config.GetBoundsLocation().Equals(OppositeBounds))
 			{
-				return AffordancePair.Key;
+				return &AffordancePair.Value;
+			}
+		}
+		for (const FUxtAffordanceInstance& AffordanceInstance : InstancedAffordances)
+		{
+			if (AffordanceInstance.Config.GetBoundsLocation().Equals(OppositeBounds))
+			{
+				return &AffordanceInstance;
 			}
 		}
 		return nullptr;
 	}
 
+	/** Scale factor that keeps affordances at the given distance from the bounds center visible. */
+	float GetAffordanceScaleFactor(float DistanceToCenter)
+	{
+		float ScaleFactor = 1.0f;
+		float DistanceThreshold = 0.0f;
+		for (const DistanceToScalePair& Pair : AffordanceDistToScale)
+		{
+			const float PreviousThreshold = DistanceThreshold;
+			DistanceThreshold = Pair.DistanceThreshold;
+			if (DistanceThreshold > DistanceToCenter)
+			{
+				// ScaleFactor already holds the previous value, so add the appropriate amount towards the one after
+				check(!FMath::IsNearlyZero(DistanceThreshold));
+				ScaleFactor += FMath::Lerp(0.0f, Pair.ScaleFactor, DistanceToCenter / DistanceThreshold);
+				break;
+			}
+			else
+			{
+				ScaleFactor = Pair.ScaleFactor;
+			}
+		}
+		return ScaleFactor;
+	}
+
 	/**
 	 * Finds the normal of the plane that a given affordance should rotate around.
 	 *
@@ -183,9 +243,6 @@ UUxtBoundsControlComponent::UUxtBoundsControlComponent()
 		TEXT("/UXTools/BoundsControl/SM_BoundingBox_ScaleHandle.SM_BoundingBox_ScaleHandle"));
 	CornerAffordanceMesh = CornerAffordanceMeshFinder.Object;
 
-	static ConstructorHelpers::FObjectFinder<UMaterialParameterCollection> Finder(TEXT("/UXTools/Materials/MPC_UXSettings"));
-	ParameterCollection = Finder.Object;
-
 	InteractionCache = MakeUnique<UxtAffordanceInteractionCache>();
 }
 
@@ -210,6 +267,11 @@ bool UUxtBoundsControlComponent::GetInitBoundsFromActor() const
 	return bInitBoundsFromActor;
 }
 
+const TArray<FUxtAffordanceInstance>& UUxtBoundsControlComponent::GetInstancedAffordances() const
+{
+	return InstancedAffordances;
+}
+
 UStaticMesh* UUxtBoundsControlComponent::GetAffordanceKindMesh(EUxtAffordanceKind Kind) const
 {
 	switch (Kind)
@@ -265,6 +327,13 @@ UPrimitiveComponent* UUxtBoundsControlComponent::GetAffordancePrimitive(const EU
 			return Pair.Key;
 		}
 	}
+	for (const FUxtAffordanceInstance& AffordanceInstance : InstancedAffordances)
+	{
+		if (AffordanceInstance.Config.Placement == Placement)
+		{
+			return AffordanceInstance.InstancedMesh;
+		}
+	}
 	return nullptr;
 }
 
@@ -310,6 +379,21 @@ void UUxtBoundsControlComponent::CreateAffordances()
 	BoundsControlGrabbable->OnUpdateGrab.AddDynamic(this, &UUxtBoundsControlComponent::OnAffordanceUpdateGrab);
 	BoundsControlGrabbable->OnEndGrab.AddDynamic(this, &UUxtBoundsControlComponent::OnAffordanceEndGrab);
 
+	if (bUseInstancedAffordances)
+	{
+		// The affordance mesh materials read scalar parameters, instances can only be highlighted by a material reading custom data
+		if (InstancedAffordanceMaterial)
+		{
+			CreateInstancedAffordances(RootComponent);
+			return;
+		}
+
+		UE_LOG(
+			LogUxtBoundsControl, Warning,
+			TEXT("%s: instanced affordances require an instanced affordance material, using one mesh per affordance."),
+			*GetOwner()->GetName());
+	}
+
 	for (const FUxtAffordanceConfig& AffordanceConfig : Config->Affordances)
 	{
 		// Create the mesh component for visuals and collision
@@ -332,6 +416,47 @@ void UUxtBoundsControlComponent::CreateAffordances()
 	}
 }
 
+void UUxtBoundsControlComponent::CreateInstancedAffordances(USceneComponent* RootComponent)
+{
+	InstancedAffordanceMeshes.Init(nullptr, NumAffordanceKinds);
+	InstancedAffordances.Reserve(Config->Affordances.Num());
+
+	for (const FUxtAffordanceConfig& AffordanceConfig : Config->Affordances)
+	{
+		const EUxtAffordanceKind Kind = AffordanceConfig.GetAffordanceKind();
+
+		// Create the instanced mesh for visuals and collision of this kind of affordance on first use
+		UInstancedStaticMeshComponent*& InstancedMesh = InstancedAffordanceMeshes[static_cast<int32>(Kind)];
+		if (!InstancedMesh)
+		{
+			const FName MeshName = FName("Affordances_" + StaticEnum<EUxtAffordanceKind>()->GetNameStringByValue(static_cast<int64>(Kind)));
+			InstancedMesh = NewObject<UInstancedStaticMeshComponent>(BoundsControlActor, MeshName);
+			InstancedMesh->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+			InstancedMesh->SetNumCustomDataFloats(NumAffordanceCustomData);
+			InstancedMesh->RegisterComponent();
+			BoundsControlActor->AddInstanceComponent(InstancedMesh);
+			if (UStaticMesh* AffordanceMesh = GetAffordanceKindMesh(Kind))
+			{
+				InstancedMesh->SetStaticMesh(AffordanceMesh);
+			}
+			InstancedMesh->SetMaterial(0, InstancedAffordanceMaterial);
+		}
+
+		// Register the affordance
+		FUxtAffordanceInstance& AffordanceInstance = InstancedAffordances.AddDefaulted_GetRef();
+		AffordanceInstance.Config = AffordanceConfig;
+		AffordanceInstance.InstancedMesh = InstancedMesh;
+		AffordanceInstance.InstanceIndex = InstancedMesh->AddInstance(FTransform::Identity);
+	}
+
+	InstancedAffordanceTransforms.SetNum(NumAffordanceKinds);
+	for (int32 MeshIndex = 0; MeshIndex < NumAffordanceKinds; ++MeshIndex)
+	{
+		const UInstancedStaticMeshComponent* InstancedMesh = InstancedAffordanceMeshes[MeshIndex];
+		InstancedAffordanceTransforms[MeshIndex].Init(FTransform::Identity, InstancedMesh ? InstancedMesh->GetInstanceCount() : 0);
+	}
+}
+
 void UUxtBoundsControlComponent::DestroyAffordances()
 {
 	// If config file wasn't valid, it's nullptr
@@ -356,6 +481,11 @@ void UUxtBoundsControlComponent::DestroyAffordances()
 
 	// Destroy affordances
 	PrimitiveAffordanceMap.Empty();
+	InstancedAffordances.Empty();
+	InstancedAffordanceMeshes.Empty();
+	InstancedAffordanceTransforms.Empty();
+	FocusingNearPointers.Empty();
+	FocusingFarPointers.Empty();
 	GetWorld()->DestroyActor(BoundsControlActor);
 }
 
@@ -377,38 +507,27 @@ void UUxtBoundsControlComponent::UpdateAffordanceTransforms()
 	}
 
 	const FVector ActorCenterLoc = GetOwner()->GetTransform().TransformPosition(Bounds.GetCenter());
-	for (auto& Item : PrimitiveAffordanceMap)
+	const FTransform BoundsTargetTransform = BoundsTargetComponent->GetComponentTransform();
+	auto UpdateAffordance = [this, &ActorCenterLoc, &BoundsTargetTransform](FUxtAffordanceInstance& AffordanceInstance)
 	{
-		FVector AffordanceLocation;
-		FQuat AffordanceRotation;
-		Item.Value.Config.GetWorldLocationAndRotation(
-			Bounds, BoundsTargetComponent->GetComponentTransform(), AffordanceLocation, AffordanceRotation);
-		Item.Key->SetWorldLocation(AffordanceLocation);
-		Item.Key->SetWorldRotation(AffordanceRotation);
+		AffordanceInstance.Config.GetWorldLocationAndRotation(
+			Bounds, BoundsTargetTransform, AffordanceInstance.Location, AffordanceInstance.Rotation);
 
-		const UPrimitiveComponent* AffordancePrimitive = Item.Key;
-		FUxtAffordanceInstance& AffordanceInstance = Item.Value;
+		const float DistanceToCenter = FVector::Distance(ActorCenterLoc, AffordanceInstance.Location);
+		AffordanceInstance.ReferenceRelativeScale = AffordanceInstance.InitialRelativeScale * GetAffordanceScaleFactor(DistanceToCenter);
+	};
 
-		const float DistanceToCenter = FVector::Distance(ActorCenterLoc, AffordanceLocation);
-		float ScaleFactor = 1.0f;
-		float DistanceThreshold = 0.0f;
-		for (const DistanceToScalePair& Pair : AffordanceDistToScale)
-		{
-			const float PreviousThreshold = DistanceThreshold;
-			DistanceThreshold = Pair.DistanceThreshold;
-			if (DistanceThreshold > DistanceToCenter)
-			{
-				// ScaleFactor already holds the previous value, so add the appropriate amount towards the one after
-				check(!FMath::IsNearlyZero(DistanceThreshold));
-				ScaleFactor += FMath::Lerp(0.0f, Pair.ScaleFactor, DistanceToCenter / DistanceThreshold);
-				break;
-			}
-			else
-			{
-				ScaleFactor = Pair.ScaleFactor;
-			}
-		}
-		AffordanceInstance.ReferenceRelativeScale = AffordanceInstance.InitialRelativeScale * ScaleFactor;
+	for (auto& Item : PrimitiveAffordanceMap)
+	{
+		UpdateAffordance(Item.Value);
+		Item.Key->SetWorldLocation(Item.Value.Location);
+		Item.Key->SetWorldRotation(Item.Value.Rotation);
+	}
+
+	// Instance transforms are updated together with the animated scale
+	for (FUxtAffordanceInstance& AffordanceInstance : InstancedAffordances)
+	{
+		UpdateAffordance(AffordanceInstance);
 	}
 }
 
@@ -417,51 +536,47 @@ void UUxtBoundsControlComponent::UpdateAffordanceAnimation(float DeltaTime)
 	// Check hand distance
 	bool bHasLeftPointer = false;
 	bool bHasRightPointer = false;
-	FLinearColor LeftPosition, RightPosition;
-	if (ParameterCollection)
+	FVector LeftPosition, RightPosition;
+	if (const UUxtParameterCollectionSubsystem* ParameterCollection = GetWorld()->GetSubsystem<UUxtParameterCollectionSubsystem>())
 	{
-		UMaterialParameterCollectionInstance* ParameterCollectionInstance = GetWorld()->GetParameterCollectionInstance(ParameterCollection);
-		bHasLeftPointer = ParameterCollectionInstance->GetVectorParameterValue(LeftPositionParam, LeftPosition);
-		bHasRightPointer = ParameterCollectionInstance->GetVectorParameterValue(RightPositionParam, RightPosition);
+		bHasLeftPointer = ParameterCollection->GetPointerPosition(EControllerHand::Left, LeftPosition);
+		bHasRightPointer = ParameterCollection->GetPointerPosition(EControllerHand::Right, RightPosition);
 	}
 
-	// Update animation for each affordance
-	for (auto& Item : PrimitiveAffordanceMap)
+	// Returns the affordance visibility and opacity and updates its focus and grab transitions
+	auto AnimateAffordance = [&](FUxtAffordanceInstance& AffordanceInstance, float& OutOpacity)
 	{
-		UPrimitiveComponent* AffordancePrimitive = Item.Key;
-		FUxtAffordanceInstance& AffordanceInstance = Item.Value;
-
 		bool bIsVisible = false;
-		float Opacity = 0.0f;
+		OutOpacity = 0.0f;
 		if (bHasLeftPointer || bHasRightPointer)
 		{
 			float MinDistance;
 			if (bHasLeftPointer && bHasRightPointer)
 			{
 				MinDistance = FMath::Min(
-					FVector::Distance(FVector(LeftPosition), AffordancePrimitive->GetComponentLocation()),
-					FVector::Distance(FVector(RightPosition), AffordancePrimitive->GetComponentLocation()));
+					FVector::Distance(LeftPosition, AffordanceInstance.Location),
+					FVector::Distance(RightPosition, AffordanceInstance.Location));
 			}
 			else if (bHasLeftPointer)
 			{
-				MinDistance = FVector::Distance(FVector(LeftPosition), AffordancePrimitive->GetComponentLocation());
+				MinDistance = FVector::Distance(LeftPosition, AffordanceInstance.Location);
 			}
 			else /* bHasRightPointer */
 			{
-				MinDistance = FVector::Distance(FVector(RightPosition), AffordancePrimitive->GetComponentLocation());
+				MinDistance = FVector::Distance(RightPosition, AffordanceInstance.Location);
 			}
 
 			// If any affordances are being grabbed make sure the grabbed affordace is visible and other affordances are not visible.
 			if (GrabbedAffordances.Num() != 0)
 			{
 				bIsVisible = IsAffordanceGrabbed(&AffordanceInstance);
-				Opacity = bIsVisible ? 1.0f : 0.0f;
+				OutOpacity = bIsVisible ? 1.0f : 0.0f;
 			}
 			else
 			{
 				// Hide affordances outside the visibility distance
 				bIsVisible = MinDistance < AffordanceVisibilityDistance;
-				Opacity = FMath::IsNearlyZero(AffordanceVisibilityDistance) ? 0.0f : 1.0f - MinDistance / AffordanceVisibilityDistance;
+				OutOpacity = FMath::IsNearlyZero(AffordanceVisibilityDistance) ? 0.0f : 1.0f - MinDistance / AffordanceVisibilityDistance;
 			}
 		}
 
@@ -474,6 +589,18 @@ void UUxtBoundsControlComponent::UpdateAffordanceAnimation(float DeltaTime)
 		AffordanceInstance.ActiveTransition =
 			FMath::Clamp(AffordanceInstance.ActiveTransition + (bAffordanceIsActive ? TransitionDelta : -TransitionDelta), 0.0f, 1.0f);
 
+		return bIsVisible;
+	};
+
+	// Update animation for each affordance
+	for (auto& Item : PrimitiveAffordanceMap)
+	{
+		UPrimitiveComponent* AffordancePrimitive = Item.Key;
+		FUxtAffordanceInstance& AffordanceInstance = Item.Value;
+
+		float Opacity;
+		const bool bIsVisible = AnimateAffordance(AffordanceInstance, Opacity);
+
 		AffordancePrimitive->SetHiddenInGame(!bIsVisible);
 		if (AffordanceInstance.DynamicMaterial)
 		{
@@ -484,6 +611,98 @@ void UUxtBoundsControlComponent::UpdateAffordanceAnimation(float DeltaTime)
 		AffordancePrimitive->SetRelativeScale3D(
 			AffordanceInstance.ReferenceRelativeScale * (1.0f + 0.2f * AffordanceInstance.FocusedTransition));
 	}
+
+	if (HasInstancedAffordances())
+	{
+		UpdateInstancedAffordanceFocus();
+
+		// Instances can't be hidden individually, hidden instances are scaled to zero instead, which also removes their collision.
+		// Transforms are applied in one batch per mesh and render state is only marked dirty for meshes that have changed.
+		bool IsMeshVisible[NumAffordanceKinds] = {};
+		bool IsMeshTransformChanged[NumAffordanceKinds] = {};
+		bool IsMeshCustomDataChanged[NumAffordanceKinds] = {};
+
+		for (FUxtAffordanceInstance& AffordanceInstance : InstancedAffordances)
+		{
+			UInstancedStaticMeshComponent* InstancedMesh = AffordanceInstance.InstancedMesh;
+			const int32 MeshIndex = static_cast<int32>(AffordanceInstance.Config.GetAffordanceKind());
+			const int32 InstanceIndex = AffordanceInstance.InstanceIndex;
+
+			float Opacity;
+			const bool bIsVisible = AnimateAffordance(AffordanceInstance, Opacity);
+			IsMeshVisible[MeshIndex] |= bIsVisible;
+
+			const FVector Scale = bIsVisible
+									  ? AffordanceInstance.ReferenceRelativeScale * (1.0f + 0.2f * AffordanceInstance.FocusedTransition)
+									  : FVector::ZeroVector;
+			const FTransform InstanceTransform = FTransform(AffordanceInstance.Rotation, AffordanceInstance.Location, Scale)
+													 .GetRelativeTransform(InstancedMesh->GetComponentTransform());
+			FTransform& AppliedTransform = InstancedAffordanceTransforms[MeshIndex][InstanceIndex];
+			if (!InstanceTransform.Equals(AppliedTransform))
+			{
+				AppliedTransform = InstanceTransform;
+				IsMeshTransformChanged[MeshIndex] = true;
+			}
+
+			const FVector3f CustomData(Opacity, AffordanceInstance.FocusedTransition, AffordanceInstance.ActiveTransition);
+			if (CustomData != AffordanceInstance.InstanceCustomData)
+			{
+				AffordanceInstance.InstanceCustomData = CustomData;
+				InstancedMesh->SetCustomDataValue(InstanceIndex, OpacityCustomDataIndex, CustomData.X);
+				InstancedMesh->SetCustomDataValue(InstanceIndex, IsFocusedCustomDataIndex, CustomData.Y);
+				InstancedMesh->SetCustomDataValue(InstanceIndex, IsActiveCustomDataIndex, CustomData.Z);
+				IsMeshCustomDataChanged[MeshIndex] = true;
+			}
+		}
+
+		for (int32 MeshIndex = 0; MeshIndex < InstancedAffordanceMeshes.Num(); ++MeshIndex)
+		{
+			if (UInstancedStaticMeshComponent* InstancedMesh = InstancedAffordanceMeshes[MeshIndex])
+			{
+				if (IsMeshTransformChanged[MeshIndex])
+				{
+					InstancedMesh->BatchUpdateInstancesTransforms(
+						0, InstancedAffordanceTransforms[MeshIndex], /* bWorldSpace = */ false, /* bMarkRenderStateDirty = */ false,
+						/* bTeleport = */ true);
+				}
+				if (IsMeshTransformChanged[MeshIndex] || IsMeshCustomDataChanged[MeshIndex])
+				{
+					InstancedMesh->MarkRenderStateDirty();
+				}
+				InstancedMesh->SetHiddenInGame(!IsMeshVisible[MeshIndex]);
+			}
+		}
+	}
+}
+
+void UUxtBoundsControlComponent::UpdateInstancedAffordanceFocus()
+{
+	for (FUxtAffordanceInstance& AffordanceInstance : InstancedAffordances)
+	{
+		AffordanceInstance.FocusCount = 0;
+	}
+
+	FVector FocusPoint;
+	for (const TWeakObjectPtr<UUxtNearPointerComponent>& Pointer : FocusingNearPointers)
+	{
+		if (Pointer.IsValid())
+		{
+			if (FUxtAffordanceInstance* AffordanceInstance = FindAffordance(GetFocusedPrimitive(Pointer.Get(), FocusPoint), FocusPoint))
+			{
+				++AffordanceInstance->FocusCount;
+			}
+		}
+	}
+	for (const TWeakObjectPtr<UUxtFarPointerComponent>& Pointer : FocusingFarPointers)
+	{
+		if (Pointer.IsValid())
+		{
+			if (FUxtAffordanceInstance* AffordanceInstance = FindAffordance(GetFocusedPrimitive(Pointer.Get(), FocusPoint), FocusPoint))
+			{
+				++AffordanceInstance->FocusCount;
+			}
+		}
+	}
 }
 
 bool UUxtBoundsControlComponent::IsAffordanceGrabbed(const FUxtAffordanceInstance* Affordance) const
@@ -645,6 +864,12 @@ void UUxtBoundsControlComponent::TransformTarget(const FUxtAffordanceConfig& Aff
 
 void UUxtBoundsControlComponent::OnAffordanceEnterFarFocus(UUxtGrabTargetComponent* Grabbable, UUxtFarPointerComponent* Pointer)
 {
+	if (HasInstancedAffordances())
+	{
+		FocusingFarPointers.AddUnique(Pointer);
+		return;
+	}
+
 	FUxtAffordanceInstance* AffordanceInstance = PrimitiveAffordanceMap.Find(GetFocusedPrimitive(Pointer));
 	if (ensure(AffordanceInstance))
 	{
@@ -654,6 +879,12 @@ void UUxtBoundsControlComponent::OnAffordanceEnterFarFocus(UUxtGrabTargetCompone
 
 void UUxtBoundsControlComponent::OnAffordanceEnterGrabFocus(UUxtGrabTargetComponent* Grabbable, UUxtNearPointerComponent* Pointer)
 {
+	if (HasInstancedAffordances())
+	{
+		FocusingNearPointers.AddUnique(Pointer);
+		return;
+	}
+
 	FUxtAffordanceInstance* AffordanceInstance = PrimitiveAffordanceMap.Find(GetFocusedPrimitive(Pointer));
 	if (ensure(AffordanceInstance))
 	{
@@ -663,6 +894,12 @@ void UUxtBoundsControlComponent::OnAffordanceEnterGrabFocus(UUxtGrabTargetCompon
 
 void UUxtBoundsControlComponent::OnAffordanceExitFarFocus(UUxtGrabTargetComponent* Grabbable, UUxtFarPointerComponent* Pointer)
 {
+	if (HasInstancedAffordances())
+	{
+		FocusingFarPointers.Remove(Pointer);
+		return;
+	}
+
 	FUxtAffordanceInstance* AffordanceInstance = PrimitiveAffordanceMap.Find(GetFocusedPrimitive(Pointer));
 	if (ensure(AffordanceInstance))
 	{
@@ -672,6 +909,12 @@ void UUxtBoundsControlComponent::OnAffordanceExitFarFocus(UUxtGrabTargetComponen
 
 void UUxtBoundsControlComponent::OnAffordanceExitGrabFocus(UUxtGrabTargetComponent* Grabbable, UUxtNearPointerComponent* Pointer)
 {
+	if (HasInstancedAffordances())
+	{
+		FocusingNearPointers.Remove(Pointer);
+		return;
+	}
+
 	FUxtAffordanceInstance* AffordanceInstance = PrimitiveAffordanceMap.Find(GetFocusedPrimitive(Pointer));
 	if (ensure(AffordanceInstance))
 	{
@@ -681,7 +924,8 @@ void UUxtBoundsControlComponent::OnAffordanceExitGrabFocus(UUxtGrabTargetCompone
 
 void UUxtBoundsControlComponent::OnAffordanceBeginGrab(UUxtGrabTargetComponent* Grabbable, FUxtGrabPointerData GrabPointer)
 {
-	FUxtAffordanceInstance* AffordanceInstance = PrimitiveAffordanceMap.Find(GetFocusedPrimitive(GrabPointer));
+	FVector FocusPoint;
+	FUxtAffordanceInstance* AffordanceInstance = FindAffordance(GetFocusedPrimitive(GrabPointer, FocusPoint), FocusPoint);
 	check(AffordanceInstance != nullptr);
 
 	// Try to start grabbing the affordance.
@@ -704,7 +948,21 @@ void UUxtBoundsControlComponent::OnAffordanceUpdateGrab(UUxtGrabTargetComponent*
 
 void UUxtBoundsControlComponent::OnAffordanceEndGrab(UUxtGrabTargetComponent* Grabbable, FUxtGrabPointerData GrabPointer)
 {
-	FUxtAffordanceInstance* AffordanceInstance = PrimitiveAffordanceMap.Find(GetFocusedPrimitive(GrabPointer));
+	FUxtAffordanceInstance* AffordanceInstance = nullptr;
+	if (HasInstancedAffordances())
+	{
+		// The pointer may have moved closer to another instance of the same mesh while grabbing.
+		// Only one affordance grab allowed for now, so it must be the grabbed one.
+		if (GrabbedAffordances.Num() == 0)
+		{
+			return;
+		}
+		AffordanceInstance = GrabbedAffordances[0];
+	}
+	else
+	{
+		AffordanceInstance = PrimitiveAffordanceMap.Find(GetFocusedPrimitive(GrabPointer));
+	}
 	check(AffordanceInstance != nullptr);
 
 	// Release grabbed affordance
@@ -725,6 +983,31 @@ void UUxtBoundsControlComponent::OnExternalManipulationStarted()
 	BoundsControlGrabbable->ForceEndGrab();
 }
 
+FUxtAffordanceInstance* UUxtBoundsControlComponent::FindAffordance(UPrimitiveComponent* Primitive, const FVector& FocusPoint)
+{
+	if (FUxtAffordanceInstance* AffordanceInstance = PrimitiveAffordanceMap.Find(Primitive))
+	{
+		return AffordanceInstance;
+	}
+
+	// Pick the closest instance of the focused mesh
+	FUxtAffordanceInstance* ClosestAffordance = nullptr;
+	float MinDistanceSqr = MAX_flt;
+	for (FUxtAffordanceInstance& AffordanceInstance : InstancedAffordances)
+	{
+		if (Primitive && AffordanceInstance.InstancedMesh == Primitive)
+		{
+			const float DistanceSqr = FVector::DistSquared(AffordanceInstance.Location, FocusPoint);
+			if (DistanceSqr < MinDistanceSqr)
+			{
+				MinDistanceSqr = DistanceSqr;
+				ClosestAffordance = &AffordanceInstance;
+			}
+		}
+	}
+	return ClosestAffordance;
+}
+
 const FUxtGrabPointerData* UUxtBoundsControlComponent::FindGrabPointer(const FUxtAffordanceInstance* AffordanceInstance)
 {
 	int32 Index = GrabbedAffordances.IndexOfByKey(AffordanceInstance);
@@ -777,10 +1060,10 @@ void UUxtBoundsControlComponent::UpdateInteractionCache(
 	InteractionCache->InitialBounds = Bounds;
 	InteractionCache->InitialTransform = GetOwner() ? GetOwner()->GetActorTransform() : FTransform::Identity;
 
-	InteractionCache->OppositeAffordancePrimitive =
-		GetOppositeAffordance(PrimitiveAffordanceMap, AffordanceInstance->Config, Config->bIsSlate);
+	InteractionCache->OppositeAffordance =
+		GetOppositeAffordance(PrimitiveAffordanceMap, InstancedAffordances, AffordanceInstance->Config, Config->bIsSlate);
 
-	if (!InteractionCache->OppositeAffordancePrimitive)
+	if (!InteractionCache->OppositeAffordance)
 	{
 		UE_LOG(
 			LogUxtBoundsControl, Error,
@@ -789,7 +1072,7 @@ void UUxtBoundsControlComponent::UpdateInteractionCache(
 		return;
 	}
 
-	InteractionCache->InitialOppositeAffordanceLoc = InteractionCache->OppositeAffordancePrimitive->GetComponentTransform().GetLocation();
+	InteractionCache->InitialOppositeAffordanceLoc = InteractionCache->OppositeAffordance->Location;
 
 	InteractionCache->InitialDiagonalDirection =
 		InteractionCache->InitialTransform.GetLocation() - InteractionCache->InitialOppositeAffordanceLoc;
@@ -8,6 +8,7 @@
 #include "Components/BoxComponent.h"
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 
 namespace
 {
@@ -135,6 +136,18 @@ void UUxtPinchSliderComponent::SetCollisionProfile(FName NewCollisionProfile)
 	ConfigureBoxComponent();
 }
 
+void UUxtPinchSliderComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtPinchSliderComponent::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 void UUxtPinchSliderComponent::BeginPlay()
 {
 	Super::BeginPlay();
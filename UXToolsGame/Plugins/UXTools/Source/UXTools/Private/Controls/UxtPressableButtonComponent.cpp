@@ -7,6 +7,7 @@
 
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Interactions/UxtInteractionUtils.h"
 #include "Utils/UxtMathUtilsFunctionLibrary.h"
 
@@ -182,6 +183,18 @@ bool UUxtPressableButtonComponent::VisualBoundsFilter(const USceneComponent* Com
 	return (Cast<const UMeshComponent>(Component) != nullptr || Cast<const UShapeComponent>(Component) != nullptr);
 }
 
+void UUxtPressableButtonComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtPressableButtonComponent::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 // Called when the game starts
 void UUxtPressableButtonComponent::BeginPlay()
 {
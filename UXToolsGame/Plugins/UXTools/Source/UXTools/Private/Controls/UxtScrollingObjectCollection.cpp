@@ -13,6 +13,7 @@
 #include "GameFramework/Actor.h"
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Interactions/UxtInteractionUtils.h"
 #include "Utils/UxtMathUtilsFunctionLibrary.h"
 
@@ -55,6 +56,7 @@ UUxtScrollingObjectCollection::UUxtScrollingObjectCollection()
 	, VelocityDamping(0.04f)
 	, BounceSpringFactor(0.75f)
 	, SnapToStrength(0.0f)
+	, VirtualizationMargin(1)
 	, Tiers(2)
 	, BoxComponent(nullptr)
 	, CollectionRoot(nullptr)
@@ -63,6 +65,9 @@ UUxtScrollingObjectCollection::UUxtScrollingObjectCollection()
 	, PaginationDelta(0.0f)
 	, PaginationOffset(0.0f)
 	, PaginationTime(0.0f)
+	, VisibleItemRange(INDEX_NONE, INDEX_NONE)
+	, bIsVirtualized(false)
+	, VirtualizedItemCount(0)
 #if WITH_EDITORONLY_DATA
 	, bCollectionInitializedInEditor(false)
 #endif // WITH_EDITORONLY_DATA
@@ -100,6 +105,18 @@ EUxtScrollDirection UUxtScrollingObjectCollection::GetScrollDirection()
 	return ScrollDirection;
 }
 
+void UUxtScrollingObjectCollection::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtScrollingObjectCollection::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 /**
  *
  */
@@ -136,6 +153,13 @@ void UUxtScrollingObjectCollection::BeginPlay()
 	{
 		Actor->AttachToComponent(CollectionRoot, FAttachmentTransformRules::KeepWorldTransform);
 	}
+
+	// Virtualized items can only be spawned once the collection root exists
+	if (bIsVirtualized)
+	{
+		ResetCollectionVisibility(true);
+		ConfigureBoxComponent();
+	}
 }
 
 /**
@@ -174,6 +198,18 @@ void UUxtScrollingObjectCollection::DestroyComponent(bool bPromoteToChildred)
 	Super::DestroyComponent(bPromoteToChildred);
 }
 
+void UUxtScrollingObjectCollection::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DestroyVirtualizedItems();
+	Super::EndPlay(EndPlayReason);
+}
+
+void UUxtScrollingObjectCollection::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	DestroyVirtualizedItems();
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
 /**
  *
  */
@@ -321,66 +357,49 @@ void UUxtScrollingObjectCollection::InitializeCollection()
 	Tiers = FMath::Max(Tiers, ScrollingObjectCollectionMinTiers); // Make sure no one sets 0;
 	const TArray<AActor*>& Actors = CollectAttachedActors();
 
-	// spin through attached actors and place them
-	// we fill actors in order, filling up 'tiers' first
-	const float TierDir = -1.0f;
-	const float OrthoDir = -1.0f;
-
-	// If the @ScrollDirection property is set to LeftAndRight then all that needs to be done at the point
-	// is to swap the axis in which the offsets are applied, placement logic remains the same
-	// Use pointers to member to make this transparent within the loop below.
-	double FVector::*pTier = &FVector::Y;
-	double FVector::*pOrtho = &FVector::Z;
-	float TierOffset = TierDir * CellWidth;
-	float OrthoOffset = OrthoDir * CellHeight;
-	if (ScrollDirection == EUxtScrollDirection::LeftAndRight)
-	{
-		pTier = &FVector::Z;
-		pOrtho = &FVector::Y;
-		TierOffset = TierDir * CellHeight;
-		OrthoOffset = OrthoDir * CellWidth;
-	}
-
-	// The logic above avoids warnings for uninitialized local variables but implicitly assumes only two possible values.
+	// Item placement and the collection size below implicitly assume only two possible scroll directions.
 	// Should anyone add a third scroll direction in the future this will need to be changed, and we should help that person find this code
 	// Note: Rather than littering this class with asserts we will assert once here, this is not the only place this assumption is made.
 	check_validscrolldirection();
 
-	FVector ActorLocation = FVector::ZeroVector;
-
-	// Outer loop iterates through actor array, one tier at a time
-	for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ActorIndex += Tiers)
+	if (bIsVirtualized)
 	{
-		// Inner loop iterates through actors that should be placed within the tier
-		// but we need to account for the fact that we might not have enough actors to fill the tier
-		const int32 NumColumnsInRow = FMath::Min(Tiers, Actors.Num() - ActorIndex);
-		for (int32 ColumnIndex = 0; ColumnIndex < NumColumnsInRow; ++ColumnIndex)
+		// Items are provided by the data source, attached actors other than the pooled ones are not part of the collection
+		for (AActor* const Actor : Actors)
 		{
-			Actors[ActorIndex + ColumnIndex]->SetActorRelativeLocation(ActorLocation);
+			if (!IsVirtualizedItemActor(Actor))
+			{
+				Actor->SetActorHiddenInGame(true);
+				Actor->SetActorTickEnabled(false);
+				Actor->SetActorEnableCollision(false);
+			}
+		}
 
-			// increment location offset in tier direction ready for the next actor
-			ActorLocation.*pTier += TierOffset;
+		// Pooled actors are placed when bound to an item
+		UnbindVirtualizedItems();
+	}
+	else
+	{
+		// Actors are placed in order, filling up 'tiers' first
+		for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ++ActorIndex)
+		{
+			Actors[ActorIndex]->SetActorRelativeLocation(GetItemRelativeLocation(ActorIndex));
 		}
-		// reset location offset in tier direction, and increment tier orthogonal offset ready for the start of the next tier
-		ActorLocation.*pTier = 0.0f;
-		ActorLocation.*pOrtho += OrthoOffset;
 	}
 
 	// Collection properties may have changed to we need to update the visibility of those contained actors
-	ResetCollectionVisibility();
+	ResetCollectionVisibility(true);
 
 	// SetupCollection Properties for broadcast
 	FScrollingCollectionProperties Properties;
 
-	FVector Size = FVector::ZeroVector;
-	Size.*pTier = TierDir * TierOffset * Tiers;
-	Size.*pOrtho = OrthoDir * OrthoOffset * ViewableArea;
-	Properties.Width = Size.Z;
-	Properties.Height = Size.Y;
+	// Tiers run along Y when scrolling up and down and along Z when scrolling left and right
+	const bool bIsVertical = ScrollDirection == EUxtScrollDirection::UpAndDown;
+	Properties.Width = CellHeight * (bIsVertical ? ViewableArea : Tiers);
+	Properties.Height = CellWidth * (bIsVertical ? Tiers : ViewableArea);
 
-	Properties.Center = FVector::ZeroVector;
-	Properties.Center.*pTier = TierOffset * (Tiers - 1) * 0.5f;
-	Properties.Center.*pOrtho = OrthoOffset * (ViewableArea - 1) * 0.5f;
+	// The viewable area spans from the first item to the last item of its last row
+	Properties.Center = GetItemRelativeLocation(ViewableArea * Tiers - 1) * 0.5f;
 
 	if (BackPlate)
 	{
@@ -405,7 +424,7 @@ void UUxtScrollingObjectCollection::InitializeCollection()
 /**
  *
  */
-void UUxtScrollingObjectCollection::ResetCollectionVisibility()
+void UUxtScrollingObjectCollection::ResetCollectionVisibility(bool bForce)
 {
 	// Based on the current total offset of the collection we can determine which items are visible
 	// within the viewable area. The offset is signed such that an offset below zero mean that the
@@ -421,6 +440,20 @@ void UUxtScrollingObjectCollection::ResetCollectionVisibility()
 	int FirstVisible = FMath::Max(FirstVisibleRow, 0) * Tiers;
 	int FirstNotVisible = FMath::Max(FirstNotVisibleRow, 0) * Tiers;
 
+	// Actor state only needs to change when the collection has scrolled to a different set of items
+	const FIntPoint NewVisibleItemRange(FirstVisible, FirstNotVisible);
+	if (!bForce && NewVisibleItemRange == VisibleItemRange)
+	{
+		return;
+	}
+	VisibleItemRange = NewVisibleItemRange;
+
+	if (bIsVirtualized)
+	{
+		UpdateVirtualizedItems(FirstVisible, FirstNotVisible);
+		return;
+	}
+
 	const TArray<AActor*>& Actors = GetAttachedActors();
 	for (int i = 0; i < Actors.Num(); ++i)
 	{
@@ -435,6 +468,215 @@ void UUxtScrollingObjectCollection::ResetCollectionVisibility()
 	}
 }
 
+void UUxtScrollingObjectCollection::UpdateVirtualizedItems(int32 FirstVisible, int32 FirstNotVisible)
+{
+	// Pooled actors are attached to the collection root, which is created in BeginPlay
+	UWorld* const World = GetWorld();
+	if (!CollectionRoot || !World)
+	{
+		return;
+	}
+
+	// Destroyed actors can not be recycled
+	VirtualizedItemPool.RemoveAll(
+		[this](const FUxtScrollingCollectionPoolEntry& Entry)
+		{
+			if (IsValid(Entry.Actor))
+			{
+				return false;
+			}
+			VirtualizedItemActors.Remove(Entry.ItemIndex);
+			return true;
+		});
+
+	// Items within the margin are bound ahead of time, so that scrolling does not have to bind items as soon as they become visible
+	const int32 Margin = FMath::Max(VirtualizationMargin, 0) * Tiers;
+	const int32 FirstBound = FMath::Max(FirstVisible - Margin, 0);
+	const int32 FirstNotBound = FMath::Min(FirstNotVisible + Margin, VirtualizedItemCount);
+
+	// Release actors whose item has moved out of the bound range
+	for (FUxtScrollingCollectionPoolEntry& Entry : VirtualizedItemPool)
+	{
+		if (Entry.ItemIndex != INDEX_NONE && (Entry.ItemIndex < FirstBound || Entry.ItemIndex >= FirstNotBound))
+		{
+			VirtualizedItemActors.Remove(Entry.ItemIndex);
+			Entry.ItemIndex = INDEX_NONE;
+		}
+	}
+
+	// Bind free actors to items that have none, spawning new actors if the pool is exhausted
+	int32 NextFreeEntry = 0;
+	for (int32 ItemIndex = FirstBound; ItemIndex < FirstNotBound; ++ItemIndex)
+	{
+		if (VirtualizedItemActors.Contains(ItemIndex))
+		{
+			continue;
+		}
+
+		while (NextFreeEntry < VirtualizedItemPool.Num() && VirtualizedItemPool[NextFreeEntry].ItemIndex != INDEX_NONE)
+		{
+			++NextFreeEntry;
+		}
+
+		if (NextFreeEntry == VirtualizedItemPool.Num())
+		{
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.Owner = GetOwner();
+			AActor* const Actor = World->SpawnActor<AActor>(VirtualizedItemClass, CollectionRoot->GetComponentTransform(), SpawnParameters);
+			if (!Actor)
+			{
+				break;
+			}
+
+			Actor->AttachToComponent(CollectionRoot, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+
+			// Newly spawned actors are visible until the visibility update below
+			FUxtScrollingCollectionPoolEntry& NewEntry = VirtualizedItemPool.AddDefaulted_GetRef();
+			NewEntry.Actor = Actor;
+			NewEntry.bVisible = true;
+		}
+
+		FUxtScrollingCollectionPoolEntry& Entry = VirtualizedItemPool[NextFreeEntry];
+		Entry.ItemIndex = ItemIndex;
+		VirtualizedItemActors.Add(ItemIndex, Entry.Actor);
+		Entry.Actor->SetActorRelativeLocation(GetItemRelativeLocation(ItemIndex));
+		BindVirtualizedItem.ExecuteIfBound(Entry.Actor, ItemIndex);
+	}
+
+	// Keep enough actors for a full viewable area including margins, e.g. after the item count has dropped.
+	// Free actors beyond that are destroyed rather than kept around hidden.
+	const int32 PoolCapacity = FMath::Min((ViewableArea + 1) * Tiers + 2 * Margin, VirtualizedItemCount);
+	for (int32 EntryIndex = VirtualizedItemPool.Num() - 1; EntryIndex >= 0 && VirtualizedItemPool.Num() > PoolCapacity; --EntryIndex)
+	{
+		if (VirtualizedItemPool[EntryIndex].ItemIndex == INDEX_NONE)
+		{
+			VirtualizedItemPool[EntryIndex].Actor->Destroy();
+			VirtualizedItemPool.RemoveAt(EntryIndex);
+		}
+	}
+
+	// Only touch actors whose visibility has changed
+	for (FUxtScrollingCollectionPoolEntry& Entry : VirtualizedItemPool)
+	{
+		const bool bVisible = Entry.ItemIndex != INDEX_NONE && Entry.ItemIndex >= FirstVisible && Entry.ItemIndex < FirstNotVisible;
+		if (Entry.bVisible != bVisible)
+		{
+			Entry.bVisible = bVisible;
+			Entry.Actor->SetActorHiddenInGame(!bVisible);
+			Entry.Actor->SetActorTickEnabled(bVisible);
+			Entry.Actor->SetActorEnableCollision(bVisible);
+		}
+	}
+}
+
+void UUxtScrollingObjectCollection::UnbindVirtualizedItems()
+{
+	for (FUxtScrollingCollectionPoolEntry& Entry : VirtualizedItemPool)
+	{
+		Entry.ItemIndex = INDEX_NONE;
+	}
+	VirtualizedItemActors.Reset();
+
+	// Make sure the next visibility update binds the items again
+	VisibleItemRange = FIntPoint(INDEX_NONE, INDEX_NONE);
+}
+
+void UUxtScrollingObjectCollection::DestroyVirtualizedItems()
+{
+	for (const FUxtScrollingCollectionPoolEntry& Entry : VirtualizedItemPool)
+	{
+		if (IsValid(Entry.Actor))
+		{
+			Entry.Actor->Destroy();
+		}
+	}
+	VirtualizedItemPool.Empty();
+	VirtualizedItemActors.Empty();
+}
+
+bool UUxtScrollingObjectCollection::IsVirtualizedItemActor(const AActor* Actor) const
+{
+	return VirtualizedItemPool.ContainsByPredicate([Actor](const FUxtScrollingCollectionPoolEntry& Entry) { return Entry.Actor == Actor; });
+}
+
+void UUxtScrollingObjectCollection::SetVirtualizedDataSource(
+	TSubclassOf<AActor> ItemClass, int32 NumItems, const FUxtScrollingObjectCollectionBindItem& BindItem)
+{
+	if (!ItemClass)
+	{
+		UE_LOG(UXTools, Warning, TEXT("Virtualized scrolling collection %s requires an item class."), *GetName());
+		return;
+	}
+
+	// Actors of the previous item class can not be recycled
+	if (VirtualizedItemClass != ItemClass)
+	{
+		DestroyVirtualizedItems();
+	}
+
+	bIsVirtualized = true;
+	VirtualizedItemClass = ItemClass;
+	VirtualizedItemCount = FMath::Max(NumItems, 0);
+	BindVirtualizedItem = BindItem;
+
+	InitializeCollection();
+	if (BoxComponent)
+	{
+		ConfigureBoxComponent();
+	}
+}
+
+void UUxtScrollingObjectCollection::SetVirtualizedItemCount(int32 NumItems)
+{
+	if (bIsVirtualized)
+	{
+		VirtualizedItemCount = FMath::Max(NumItems, 0);
+		RefreshVirtualizedItems();
+
+		if (BoxComponent)
+		{
+			ConfigureBoxComponent();
+		}
+	}
+}
+
+void UUxtScrollingObjectCollection::RefreshVirtualizedItems()
+{
+	if (bIsVirtualized)
+	{
+		UnbindVirtualizedItems();
+		ResetCollectionVisibility(true);
+	}
+}
+
+AActor* UUxtScrollingObjectCollection::GetItemActor(int32 ItemIndex) const
+{
+	if (bIsVirtualized)
+	{
+		return VirtualizedItemActors.FindRef(ItemIndex);
+	}
+
+	const TArray<AActor*>& Actors = GetAttachedActors();
+	return Actors.IsValidIndex(ItemIndex) ? Actors[ItemIndex] : nullptr;
+}
+
+int32 UUxtScrollingObjectCollection::GetNumItems() const
+{
+	return bIsVirtualized ? VirtualizedItemCount : GetAttachedActors().Num();
+}
+
+FVector UUxtScrollingObjectCollection::GetItemRelativeLocation(int32 ItemIndex) const
+{
+	check_validscrolldirection();
+
+	// Items fill up 'tiers' first, both tier and orthogonal offsets grow in the negative direction
+	const float TierOffset = -(ItemIndex % Tiers) * (ScrollDirection == EUxtScrollDirection::UpAndDown ? CellWidth : CellHeight);
+	const float OrthoOffset = -(ItemIndex / Tiers) * (ScrollDirection == EUxtScrollDirection::UpAndDown ? CellHeight : CellWidth);
+
+	return ScrollDirection == EUxtScrollDirection::UpAndDown ? FVector(0.0f, TierOffset, OrthoOffset)
+															 : FVector(0.0f, OrthoOffset, TierOffset);
+}
+
 /**
  *
  */
@@ -465,9 +707,23 @@ void UUxtScrollingObjectCollection::ConfigureBoxComponent()
 		// we are operating in component local space
 		FBox BoundingBox(EForceInit::ForceInit);
 		const FTransform& WorldToLocal = GetComponentTransform().Inverse();
-		for (AActor* const Actor : GetAttachedActors())
+
+		TArray<AActor*, TInlineAllocator<32>> ItemActors;
+		if (bIsVirtualized)
+		{
+			for (const FUxtScrollingCollectionPoolEntry& Entry : VirtualizedItemPool)
+			{
+				ItemActors.Add(Entry.Actor);
+			}
+		}
+		else
+		{
+			ItemActors.Append(GetAttachedActors());
+		}
+
+		for (AActor* const Actor : ItemActors)
 		{
-			if (Actor->GetActorEnableCollision())
+			if (IsValid(Actor) && Actor->GetActorEnableCollision())
 			{
 				const bool bNonColliding = false;
 				BoundingBox +=
@@ -514,7 +770,7 @@ float UUxtScrollingObjectCollection::GetTierOffsetFromLocation(const FVector Loc
  */
 int UUxtScrollingObjectCollection::GetNumberOfRowsInCollection() const
 {
-	const int NoofActors = GetAttachedActors().Num();
+	const int NoofActors = GetNumItems();
 	int NoofRows = (NoofActors / Tiers);
 	// A remainder means that we need an extra row.
 	if (NoofActors % Tiers > 0)
@@ -679,12 +935,12 @@ void UUxtScrollingObjectCollection::CheckScrollOrClick()
 
 			if (ButtonIndex != -1)
 			{
-				const TArray<AActor*>& Actors = GetAttachedActors();
-				if (Actors.IsValidIndex(ButtonIndex) && Actors[ButtonIndex])
+				AActor* const ItemActor = GetItemActor(ButtonIndex);
+				if (ItemActor)
 				{
-					if (Actors[ButtonIndex]->GetClass()->ImplementsInterface(UUxtCollectionObject::StaticClass()))
+					if (ItemActor->GetClass()->ImplementsInterface(UUxtCollectionObject::StaticClass()))
 					{
-						PokeTarget = IUxtCollectionObject::Execute_GetPokeTarget(Actors[ButtonIndex]);
+						PokeTarget = IUxtCollectionObject::Execute_GetPokeTarget(ItemActor);
 						if (PokeTarget)
 						{
 							IUxtPokeHandler::Execute_OnBeginPoke(PokeTarget.GetObject(), Pointer);
@@ -710,12 +966,12 @@ void UUxtScrollingObjectCollection::CheckScrollOrClickFarPointer()
 
 			if (ButtonIndex != -1)
 			{
-				const TArray<AActor*>& Actors = GetAttachedActors();
-				if (Actors.IsValidIndex(ButtonIndex) && Actors[ButtonIndex])
+				AActor* const ItemActor = GetItemActor(ButtonIndex);
+				if (ItemActor)
 				{
-					if (Actors[ButtonIndex]->GetClass()->ImplementsInterface(UUxtCollectionObject::StaticClass()))
+					if (ItemActor->GetClass()->ImplementsInterface(UUxtCollectionObject::StaticClass()))
 					{
-						FarTarget = IUxtCollectionObject::Execute_GetFarTarget(Actors[ButtonIndex]);
+						FarTarget = IUxtCollectionObject::Execute_GetFarTarget(ItemActor);
 						if (FarTarget)
 						{
 							IUxtFarHandler::Execute_OnFarPressed(FarTarget.GetObject(), Pointer);
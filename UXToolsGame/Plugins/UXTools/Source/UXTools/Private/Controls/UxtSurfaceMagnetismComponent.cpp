@@ -6,6 +6,7 @@
 #include "DrawDebugHelpers.h"
 
 #include "GameFramework/Actor.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Utils/UxtFunctionLibrary.h"
@@ -43,6 +44,18 @@ void UUxtSurfaceMagnetismComponent::TickComponent(float DeltaTime, ELevelTick Ti
 	}
 }
 
+void UUxtSurfaceMagnetismComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtSurfaceMagnetismComponent::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 void UUxtSurfaceMagnetismComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -7,6 +7,7 @@
 
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Interactions/UxtInteractionUtils.h"
 
 #include <Components/PrimitiveComponent.h>
@@ -36,6 +37,18 @@ void UUxtTouchableVolumeComponent::SetEnabled(bool Enabled)
 	}
 }
 
+void UUxtTouchableVolumeComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtTouchableVolumeComponent::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 // Called when the game starts
 void UUxtTouchableVolumeComponent::BeginPlay()
 {
@@ -8,6 +8,7 @@
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Input/UxtPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Interactions/UxtInteractionUtils.h"
 
 #include <Components/PrimitiveComponent.h>
@@ -28,6 +29,18 @@ namespace
 	}
 } // namespace
 
+void UUxtWidgetComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtWidgetComponent::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 void UUxtWidgetComponent::BeginPlay()
 {
 	Super::BeginPlay();
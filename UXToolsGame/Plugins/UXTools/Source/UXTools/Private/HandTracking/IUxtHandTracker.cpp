@@ -4,6 +4,7 @@
 #include "HandTracking/IUxtHandTracker.h"
 
 #include "Features/IModularFeatures.h"
+#include "HandTracking/UxtHandFrameCache.h"
 
 /* Fallback implementation of the hand tracker interface.
  * In case the modular feature has not been implemented this will ensure a valid singleton reference is returned.
@@ -21,6 +22,13 @@ public:
 		return false;
 	}
 
+	virtual bool GetAllJointStates(
+		EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions,
+		TArrayView<float> OutRadii) const override
+	{
+		return false;
+	}
+
 	virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override { return false; }
 
 	virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override { return false; }
@@ -28,6 +36,11 @@ public:
 	virtual bool GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const override { return false; }
 
 	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override { return false; }
+
+	virtual const FUxtHandFrame& GetHandFrame(EControllerHand Hand) const override { return HandFrameCache.GetHandFrame(*this, Hand); }
+
+private:
+	mutable FUxtHandFrameCache HandFrameCache {false};
 };
 
 FName IUxtHandTracker::GetModularFeatureName()
@@ -36,6 +49,75 @@ FName IUxtHandTracker::GetModularFeatureName()
 	return FeatureName;
 }
 
+bool IUxtHandTracker::GetAllJointStates(
+	EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions, TArrayView<float> OutRadii) const
+{
+	check(OutOrientations.Num() == EHandKeypointCount && OutPositions.Num() == EHandKeypointCount && OutRadii.Num() == EHandKeypointCount);
+
+	// Gather the joints first, outputs must be unchanged if any joint is not available
+	FQuat Orientations[EHandKeypointCount];
+	FVector Positions[EHandKeypointCount];
+	float Radii[EHandKeypointCount];
+	for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+	{
+		if (!GetJointState(Hand, (EHandKeypoint)Joint, Orientations[Joint], Positions[Joint], Radii[Joint]))
+		{
+			return false;
+		}
+	}
+
+	FMemory::Memcpy(OutOrientations.GetData(), Orientations, sizeof(Orientations));
+	FMemory::Memcpy(OutPositions.GetData(), Positions, sizeof(Positions));
+	FMemory::Memcpy(OutRadii.GetData(), Radii, sizeof(Radii));
+	return true;
+}
+
+bool IUxtHandTracker::GetRawJointState(
+	EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
+{
+	return GetJointState(Hand, Joint, OutOrientation, OutPosition, OutRadius);
+}
+
+bool IUxtHandTracker::GetAllRawJointStates(
+	EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions, TArrayView<float> OutRadii) const
+{
+	return GetAllJointStates(Hand, OutOrientations, OutPositions, OutRadii);
+}
+
+const FUxtHandJointFilterSettings& IUxtHandTracker::GetJointFilterSettings() const
+{
+	static const FUxtHandJointFilterSettings DisabledSettings;
+	return DisabledSettings;
+}
+
+const FUxtHandHistory& IUxtHandTracker::GetHandHistory(EControllerHand Hand) const
+{
+	static const FUxtHandHistory EmptyHistory;
+	return EmptyHistory;
+}
+
+const FUxtHandPredictionSettings& IUxtHandTracker::GetPredictionSettings() const
+{
+	static const FUxtHandPredictionSettings DisabledSettings;
+	return DisabledSettings;
+}
+
+bool IUxtHandTracker::GetPredictedJointState(
+	EControllerHand Hand, EHandKeypoint Joint, double TargetTime, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
+{
+	return GetJointState(Hand, Joint, OutOrientation, OutPosition, OutRadius);
+}
+
+bool IUxtHandTracker::GetPredictedPointerPose(EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return GetPointerPose(Hand, OutOrientation, OutPosition);
+}
+
+bool IUxtHandTracker::GetPredictedGripPose(EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return GetGripPose(Hand, OutOrientation, OutPosition);
+}
+
 IUxtHandTracker& IUxtHandTracker::Get()
 {
 	// Fallback implementation if modular feature is not registered
@@ -0,0 +1,139 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandFrame.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+
+void FUxtHandFrame::Capture(const IUxtHandTracker& HandTracker, EControllerHand InHand)
+{
+	Hand = InHand;
+	TrackingStatus = HandTracker.GetTrackingStatus(Hand);
+	ComputedValues = 0;
+
+	bHasJoints = HandTracker.GetAllJointStates(Hand, JointOrientations, JointPositions, JointRadii);
+	if (!bHasJoints)
+	{
+		for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+		{
+			JointOrientations[Joint] = FQuat::Identity;
+			JointPositions[Joint] = FVector::ZeroVector;
+			JointRadii[Joint] = 0.0f;
+		}
+
+		// Joint based values keep their defaults
+		GrabPointerTransform = FTransform::Identity;
+		PalmPlane = FPlane(ForceInit);
+		FingerPlaneNormal = FVector::ZeroVector;
+		Bounds = FBox(ForceInit);
+		ComputedValues = MAX_uint8;
+	}
+
+	FQuat Orientation;
+	FVector Position;
+	bHasPointerPose = HandTracker.GetPointerPose(Hand, Orientation, Position);
+	PointerTransform = bHasPointerPose ? FTransform(Orientation, Position) : FTransform::Identity;
+
+	bHasGripPose = HandTracker.GetGripPose(Hand, Orientation, Position);
+	GripTransform = bHasGripPose ? FTransform(Orientation, Position) : FTransform::Identity;
+}
+
+const FTransform& FUxtHandFrame::GetGrabPointerTransform() const
+{
+	if (ComputeOnce(EDerivedValue::GrabPointerTransform))
+	{
+		// Use the midway point between the thumb and index finger tips for grab
+		const float LerpFactor = 0.5f;
+		GrabPointerTransform = FTransform(
+			FMath::Lerp(GetJointOrientation(EHandKeypoint::IndexTip), GetJointOrientation(EHandKeypoint::ThumbTip), LerpFactor),
+			FMath::Lerp(GetJointPosition(EHandKeypoint::IndexTip), GetJointPosition(EHandKeypoint::ThumbTip), LerpFactor));
+	}
+	return GrabPointerTransform;
+}
+
+float FUxtHandFrame::GetPinchDistance() const
+{
+	return FVector::Dist(GetJointPosition(EHandKeypoint::IndexTip), GetJointPosition(EHandKeypoint::ThumbTip));
+}
+
+const FPlane& FUxtHandFrame::GetPalmPlane() const
+{
+	if (ComputeOnce(EDerivedValue::PalmPlane))
+	{
+		PalmPlane = FPlane(
+			GetJointPosition(EHandKeypoint::Wrist), GetJointPosition(EHandKeypoint::IndexMetacarpal),
+			GetJointPosition(EHandKeypoint::LittleMetacarpal));
+	}
+	return PalmPlane;
+}
+
+const FVector& FUxtHandFrame::GetFingerPlaneNormal() const
+{
+	if (ComputeOnce(EDerivedValue::FingerPlaneNormal))
+	{
+		const FVector& PalmPosition = GetJointPosition(EHandKeypoint::Palm);
+		const FVector PalmToRing = GetJointPosition(EHandKeypoint::RingTip) - PalmPosition;
+		const FVector PalmToIndex = GetJointPosition(EHandKeypoint::IndexTip) - PalmPosition;
+		FingerPlaneNormal = FVector::CrossProduct(PalmToRing, PalmToIndex).GetSafeNormal();
+
+		// Fingers are mirrored on the right hand
+		if (Hand != EControllerHand::Left)
+		{
+			FingerPlaneNormal = -FingerPlaneNormal;
+		}
+	}
+	return FingerPlaneNormal;
+}
+
+const FBox& FUxtHandFrame::GetBounds() const
+{
+	if (ComputeOnce(EDerivedValue::Bounds))
+	{
+		const FTransform PalmFromWorld = GetJointTransform(EHandKeypoint::Palm).Inverse();
+
+		Bounds.Init();
+		for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+		{
+			// Union with box around the joint in palm space, using radius for padding
+			const FVector LocalPosition = PalmFromWorld.TransformPosition(JointPositions[Joint]);
+			Bounds += FBox::BuildAABB(LocalPosition, FVector(JointRadii[Joint]));
+		}
+	}
+	return Bounds;
+}
+
+bool FUxtHandFrame::IsInPointingPose(const FVector& ViewForward) const
+{
+	// Controllers without joints are always pointing
+	if (!bHasJoints)
+	{
+		return true;
+	}
+
+	// Normal of the inside of the palm
+	const FVector PalmNormal = -GetPalmUpVector();
+
+	if (FVector::DotProduct(PalmNormal, -ViewForward) > PointingPoseBackwardTolerance)
+	{
+		return false;
+	}
+
+	if (FVector::DotProduct(PalmNormal, FVector::UpVector) > PointingPoseUpwardTolerance)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool FUxtHandFrame::ComputeOnce(EDerivedValue Value) const
+{
+	const uint8 Flag = (uint8)Value;
+	if (ComputedValues & Flag)
+	{
+		return false;
+	}
+
+	ComputedValues |= Flag;
+	return true;
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandFrameCache.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+#include "Misc/App.h"
+
+namespace
+{
+	int32 GetHandFrameIndex(EControllerHand Hand)
+	{
+		switch (Hand)
+		{
+		case EControllerHand::Left:
+			return 0;
+		case EControllerHand::Right:
+			return 1;
+		default:
+			return 2;
+		}
+	}
+} // namespace
+
+FUxtHandFrameCache::FUxtHandFrameCache(bool bKeepHistories)
+{
+	if (bKeepHistories)
+	{
+		HandHistories.SetNum(2);
+	}
+}
+
+const FUxtHandFrame& FUxtHandFrameCache::GetHandFrame(const IUxtHandTracker& HandTracker, EControllerHand Hand)
+{
+	// Other hands share a slot, recapture when a different hand is requested within the frame
+	const int32 Index = GetHandFrameIndex(Hand);
+	if (HandFramesCounter[Index] != GFrameCounter || HandFrames[Index].GetHand() != Hand)
+	{
+		CaptureHandFrame(HandTracker, Index, Hand);
+	}
+	return HandFrames[Index];
+}
+
+const FUxtHandHistory& FUxtHandFrameCache::GetHandHistory(const IUxtHandTracker& HandTracker, EControllerHand Hand)
+{
+	const int32 Index = GetHandFrameIndex(Hand);
+	if (!HandHistories.IsValidIndex(Index))
+	{
+		static const FUxtHandHistory EmptyHistory;
+		return EmptyHistory;
+	}
+
+	// Make sure the current frame has been sampled
+	GetHandFrame(HandTracker, Hand);
+	return HandHistories[Index];
+}
+
+bool FUxtHandFrameCache::GetPredictedJointState(
+	const IUxtHandTracker& HandTracker, EControllerHand Hand, EHandKeypoint Joint, double TargetTime, FQuat& OutOrientation,
+	FVector& OutPosition, float& OutRadius)
+{
+	const FUxtHandFrame& HandFrame = GetHandFrame(HandTracker, Hand);
+	if (!HandFrame.HasJoints())
+	{
+		return false;
+	}
+
+	if (!PredictionSettings.bEnabled ||
+		!FUxtHandPosePredictor(GetHandHistory(HandTracker, Hand)).PredictJoint(
+			Joint, TargetTime, PredictionSettings.MaxPredictionTime, OutOrientation, OutPosition))
+	{
+		OutOrientation = HandFrame.GetJointOrientation(Joint);
+		OutPosition = HandFrame.GetJointPosition(Joint);
+	}
+	OutRadius = HandFrame.GetJointRadius(Joint);
+	return true;
+}
+
+bool FUxtHandFrameCache::GetPredictedPointerPose(
+	const IUxtHandTracker& HandTracker, EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition)
+{
+	const FUxtHandFrame& HandFrame = GetHandFrame(HandTracker, Hand);
+	if (!HandFrame.HasPointerPose())
+	{
+		return false;
+	}
+
+	if (!PredictionSettings.bEnabled ||
+		!FUxtHandPosePredictor(GetHandHistory(HandTracker, Hand)).PredictPointerPose(
+			TargetTime, PredictionSettings.MaxPredictionTime, OutOrientation, OutPosition))
+	{
+		OutOrientation = HandFrame.GetPointerTransform().GetRotation();
+		OutPosition = HandFrame.GetPointerTransform().GetLocation();
+	}
+	return true;
+}
+
+bool FUxtHandFrameCache::GetPredictedGripPose(
+	const IUxtHandTracker& HandTracker, EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition)
+{
+	const FUxtHandFrame& HandFrame = GetHandFrame(HandTracker, Hand);
+	if (!HandFrame.HasGripPose())
+	{
+		return false;
+	}
+
+	if (!PredictionSettings.bEnabled ||
+		!FUxtHandPosePredictor(GetHandHistory(HandTracker, Hand)).PredictGripPose(
+			TargetTime, PredictionSettings.MaxPredictionTime, OutOrientation, OutPosition))
+	{
+		OutOrientation = HandFrame.GetGripTransform().GetRotation();
+		OutPosition = HandFrame.GetGripTransform().GetLocation();
+	}
+	return true;
+}
+
+void FUxtHandFrameCache::Update(const IUxtHandTracker& HandTracker)
+{
+	for (const EControllerHand Hand : {EControllerHand::Left, EControllerHand::Right})
+	{
+		CaptureHandFrame(HandTracker, GetHandFrameIndex(Hand), Hand);
+	}
+
+	// Other hands are rarely used, capture them on demand
+	HandFramesCounter[GetHandFrameIndex(EControllerHand::AnyHand)] = MAX_uint64;
+}
+
+void FUxtHandFrameCache::Invalidate()
+{
+	for (uint64& Counter : HandFramesCounter)
+	{
+		Counter = MAX_uint64;
+	}
+}
+
+void FUxtHandFrameCache::Reset()
+{
+	for (FUxtHandHistory& HandHistory : HandHistories)
+	{
+		HandHistory.Reset();
+	}
+
+	Invalidate();
+}
+
+void FUxtHandFrameCache::CaptureHandFrame(const IUxtHandTracker& HandTracker, int32 Index, EControllerHand Hand)
+{
+	HandFramesCounter[Index] = GFrameCounter;
+	HandFrames[Index].Capture(HandTracker, Hand);
+
+	if (HandHistories.IsValidIndex(Index))
+	{
+		HandHistories[Index].AddSample(FApp::GetCurrentTime(), HandFrames[Index]);
+	}
+}
@@ -0,0 +1,198 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandHistory.h"
+
+void FUxtHandHistorySample::SetPoses(const FUxtHandFrame& HandFrame)
+{
+	bHasJoints = HandFrame.HasJoints();
+	bHasPointerPose = HandFrame.HasPointerPose();
+	bHasGripPose = HandFrame.HasGripPose();
+
+	if (bHasJoints)
+	{
+		for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+		{
+			JointOrientations[Joint] = FQuat4f(HandFrame.GetJointOrientation((EHandKeypoint)Joint));
+			JointPositions[Joint] = FVector3f(HandFrame.GetJointPosition((EHandKeypoint)Joint));
+		}
+	}
+
+	if (bHasPointerPose)
+	{
+		PointerOrientation = FQuat4f(HandFrame.GetPointerTransform().GetRotation());
+		PointerPosition = FVector3f(HandFrame.GetPointerTransform().GetLocation());
+	}
+
+	if (bHasGripPose)
+	{
+		GripOrientation = FQuat4f(HandFrame.GetGripTransform().GetRotation());
+		GripPosition = FVector3f(HandFrame.GetGripTransform().GetLocation());
+	}
+}
+
+bool FUxtHandHistorySample::HasPose(EUxtHandHistoryPose Pose) const
+{
+	switch (Pose)
+	{
+	case EUxtHandHistoryPose::Joint:
+		return bHasJoints;
+	case EUxtHandHistoryPose::Pointer:
+		return bHasPointerPose;
+	case EUxtHandHistoryPose::Grip:
+		return bHasGripPose;
+	}
+	return false;
+}
+
+FTransform FUxtHandHistorySample::GetPose(EUxtHandHistoryPose Pose, EHandKeypoint Joint) const
+{
+	switch (Pose)
+	{
+	case EUxtHandHistoryPose::Joint:
+		return FTransform(FQuat(JointOrientations[(int32)Joint]), FVector(JointPositions[(int32)Joint]));
+	case EUxtHandHistoryPose::Pointer:
+		return FTransform(FQuat(PointerOrientation), FVector(PointerPosition));
+	case EUxtHandHistoryPose::Grip:
+		return FTransform(FQuat(GripOrientation), FVector(GripPosition));
+	}
+	return FTransform::Identity;
+}
+
+void FUxtHandHistory::Reset()
+{
+	Head = 0;
+	NumSamples = 0;
+}
+
+void FUxtHandHistory::AddSample(double Time, const FUxtHandFrame& HandFrame)
+{
+	if (NumSamples > 0)
+	{
+		const FUxtHandHistorySample& Latest = GetSample(0);
+
+		// Motion across tracking loss is meaningless, and time must advance for velocities to be defined
+		if (Latest.bHasJoints != HandFrame.HasJoints() || Latest.bHasPointerPose != HandFrame.HasPointerPose() ||
+			Latest.bHasGripPose != HandFrame.HasGripPose() || Time < Latest.Time)
+		{
+			Reset();
+		}
+		else if (Time == Latest.Time)
+		{
+			// Replace the sample, e.g. when the hand changed within the frame
+			Samples[Head].SetPoses(HandFrame);
+			return;
+		}
+	}
+
+	Head = (Head + 1) % Capacity;
+	NumSamples = FMath::Min(NumSamples + 1, Capacity);
+
+	FUxtHandHistorySample& Sample = Samples[Head];
+	Sample.Time = Time;
+	Sample.SetPoses(HandFrame);
+}
+
+const FUxtHandHistorySample& FUxtHandHistory::GetSample(int32 Age) const
+{
+	check(Age >= 0 && Age < NumSamples);
+	return Samples[(Head - Age + Capacity) % Capacity];
+}
+
+bool FUxtHandHistory::HasPose(EUxtHandHistoryPose Pose) const
+{
+	return NumSamples > 0 && GetSample(0).HasPose(Pose);
+}
+
+bool FUxtHandHistory::GetPoseAtTime(EUxtHandHistoryPose Pose, double Time, FTransform& OutPose, EHandKeypoint Joint) const
+{
+	if (!HasPose(Pose))
+	{
+		return false;
+	}
+
+	for (int32 Age = 0; Age < NumSamples; ++Age)
+	{
+		const FUxtHandHistorySample& Older = GetSample(Age);
+		if (Older.Time > Time)
+		{
+			continue;
+		}
+
+		const FTransform OlderPose = Older.GetPose(Pose, Joint);
+		if (Age == 0 || Older.Time == Time)
+		{
+			// Only the most recent sample can be older than the time
+			if (Age == 0 && Older.Time < Time)
+			{
+				return false;
+			}
+			OutPose = OlderPose;
+			return true;
+		}
+
+		const FUxtHandHistorySample& Newer = GetSample(Age - 1);
+		const FTransform NewerPose = Newer.GetPose(Pose, Joint);
+		const float Alpha = (Time - Older.Time) / (Newer.Time - Older.Time);
+		OutPose = FTransform(
+			FQuat::Slerp(OlderPose.GetRotation(), NewerPose.GetRotation(), Alpha),
+			FMath::Lerp(OlderPose.GetLocation(), NewerPose.GetLocation(), Alpha));
+		return true;
+	}
+
+	return false;
+}
+
+bool FUxtHandHistory::GetLinearVelocity(EUxtHandHistoryPose Pose, float Window, FVector& OutVelocity, EHandKeypoint Joint) const
+{
+	FTransform StartPose, EndPose;
+	double Duration;
+	if (!GetWindowPoses(Pose, Window, Joint, StartPose, EndPose, Duration))
+	{
+		return false;
+	}
+
+	OutVelocity = (EndPose.GetLocation() - StartPose.GetLocation()) / Duration;
+	return true;
+}
+
+bool FUxtHandHistory::GetAngularVelocity(EUxtHandHistoryPose Pose, float Window, FVector& OutAngularVelocity, EHandKeypoint Joint) const
+{
+	FTransform StartPose, EndPose;
+	double Duration;
+	if (!GetWindowPoses(Pose, Window, Joint, StartPose, EndPose, Duration))
+	{
+		return false;
+	}
+
+	// Rotation from the start to the end orientation in world space, using the shortest arc
+	FQuat DeltaRotation = EndPose.GetRotation() * StartPose.GetRotation().Inverse();
+	DeltaRotation.EnforceShortestArcWith(FQuat::Identity);
+
+	FVector Axis;
+	FQuat::FReal Angle;
+	DeltaRotation.ToAxisAndAngle(Axis, Angle);
+	OutAngularVelocity = Axis * (Angle / Duration);
+	return true;
+}
+
+bool FUxtHandHistory::GetWindowPoses(
+	EUxtHandHistoryPose Pose, float Window, EHandKeypoint Joint, FTransform& OutStartPose, FTransform& OutEndPose,
+	double& OutDuration) const
+{
+	if (!HasPose(Pose) || NumSamples < 2)
+	{
+		return false;
+	}
+
+	const FUxtHandHistorySample& Latest = GetSample(0);
+	const double StartTime = FMath::Max(Latest.Time - Window, GetSample(NumSamples - 1).Time);
+	OutDuration = Latest.Time - StartTime;
+	if (OutDuration <= 0.0)
+	{
+		return false;
+	}
+
+	OutEndPose = Latest.GetPose(Pose, Joint);
+	return GetPoseAtTime(Pose, StartTime, OutStartPose, Joint);
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandJointFilter.h"
+
+static_assert(sizeof(FVector) == 3 * sizeof(FVector::FReal), "Joint positions are filtered as a flat array of coordinates");
+
+namespace
+{
+	/** Smoothing factor of an exponential filter with the given cutoff frequency. */
+	float GetSmoothingFactor(float DeltaTime, float Cutoff)
+	{
+		const float TimeConstant = 1.0f / (2.0f * PI * Cutoff);
+		return DeltaTime / (DeltaTime + TimeConstant);
+	}
+} // namespace
+
+void FUxtHandJointFilter::Reset()
+{
+	bHasState = false;
+}
+
+void FUxtHandJointFilter::Update(
+	const FQuat* NewOrientations, const FVector* NewPositions, float DeltaTime, const FUxtHandJointFilterSettings& Settings)
+{
+	if (!bHasState)
+	{
+		FMemory::Memcpy(Orientations, NewOrientations, sizeof(Orientations));
+		FMemory::Memcpy(Positions, NewPositions, sizeof(Positions));
+		FMemory::Memzero(PositionDerivatives, sizeof(PositionDerivatives));
+		FMemory::Memzero(AngularSpeeds, sizeof(AngularSpeeds));
+		bHasState = true;
+		return;
+	}
+
+	// Keep the filtered joints if no time has passed, e.g. while paused
+	if (DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	const float InvDeltaTime = 1.0f / DeltaTime;
+
+	FVector::FReal* Coordinates = &Positions[0].X;
+	FVector::FReal* CoordinateDerivatives = &PositionDerivatives[0].X;
+	const FVector::FReal* NewCoordinates = &NewPositions[0].X;
+
+	// Expand the derivative smoothing factors of the joints to their coordinates
+	FVector::FReal DerivativeSmoothingFactors[NumCoordinates];
+	for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+	{
+		const FUxtOneEuroFilterSettings& JointSettings = GetJointSettings(Settings, (EHandKeypoint)Joint);
+		const float SmoothingFactor = GetSmoothingFactor(DeltaTime, JointSettings.DerivativeCutoff);
+		DerivativeSmoothingFactors[Joint * 3 + 0] = SmoothingFactor;
+		DerivativeSmoothingFactors[Joint * 3 + 1] = SmoothingFactor;
+		DerivativeSmoothingFactors[Joint * 3 + 2] = SmoothingFactor;
+	}
+
+	// Smooth the speed of all coordinates
+	for (int32 Index = 0; Index < NumCoordinates; ++Index)
+	{
+		const FVector::FReal Speed = (NewCoordinates[Index] - Coordinates[Index]) * InvDeltaTime;
+		CoordinateDerivatives[Index] += DerivativeSmoothingFactors[Index] * (Speed - CoordinateDerivatives[Index]);
+	}
+
+	// Adapt the cutoff of each joint to its speed
+	FVector::FReal SmoothingFactors[NumCoordinates];
+	for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+	{
+		const FUxtOneEuroFilterSettings& JointSettings = GetJointSettings(Settings, (EHandKeypoint)Joint);
+		const float Cutoff = JointSettings.MinCutoff + JointSettings.Beta * PositionDerivatives[Joint].Size();
+		const float SmoothingFactor = GetSmoothingFactor(DeltaTime, Cutoff);
+		SmoothingFactors[Joint * 3 + 0] = SmoothingFactor;
+		SmoothingFactors[Joint * 3 + 1] = SmoothingFactor;
+		SmoothingFactors[Joint * 3 + 2] = SmoothingFactor;
+	}
+
+	// Smooth all coordinates
+	for (int32 Index = 0; Index < NumCoordinates; ++Index)
+	{
+		Coordinates[Index] += SmoothingFactors[Index] * (NewCoordinates[Index] - Coordinates[Index]);
+	}
+
+	for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+	{
+		const FUxtOneEuroFilterSettings& JointSettings = GetJointSettings(Settings, (EHandKeypoint)Joint);
+
+		const float AngularSpeed = FMath::RadiansToDegrees(Orientations[Joint].AngularDistance(NewOrientations[Joint])) * InvDeltaTime;
+		AngularSpeeds[Joint] += GetSmoothingFactor(DeltaTime, JointSettings.DerivativeCutoff) * (AngularSpeed - AngularSpeeds[Joint]);
+
+		const float Cutoff = JointSettings.MinCutoff + JointSettings.Beta * AngularSpeeds[Joint];
+		Orientations[Joint] = FQuat::Slerp(Orientations[Joint], NewOrientations[Joint], GetSmoothingFactor(DeltaTime, Cutoff));
+	}
+}
+
+const FUxtOneEuroFilterSettings& FUxtHandJointFilter::GetJointSettings(const FUxtHandJointFilterSettings& Settings, EHandKeypoint Joint)
+{
+	switch (Joint)
+	{
+	case EHandKeypoint::Palm:
+	case EHandKeypoint::Wrist:
+	case EHandKeypoint::ThumbMetacarpal:
+	case EHandKeypoint::IndexMetacarpal:
+	case EHandKeypoint::MiddleMetacarpal:
+	case EHandKeypoint::RingMetacarpal:
+	case EHandKeypoint::LittleMetacarpal:
+		return Settings.Palm;
+
+	case EHandKeypoint::ThumbTip:
+	case EHandKeypoint::IndexTip:
+	case EHandKeypoint::MiddleTip:
+	case EHandKeypoint::RingTip:
+	case EHandKeypoint::LittleTip:
+		return Settings.FingerTips;
+
+	default:
+		return Settings.Fingers;
+	}
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandPosePredictor.h"
+
+bool FUxtHandPosePredictor::PredictJoint(
+	EHandKeypoint Joint, double TargetTime, float MaxPredictionTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return Predict(EUxtHandHistoryPose::Joint, Joint, TargetTime, MaxPredictionTime, OutOrientation, OutPosition);
+}
+
+bool FUxtHandPosePredictor::PredictPointerPose(
+	double TargetTime, float MaxPredictionTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return Predict(EUxtHandHistoryPose::Pointer, EHandKeypoint::Palm, TargetTime, MaxPredictionTime, OutOrientation, OutPosition);
+}
+
+bool FUxtHandPosePredictor::PredictGripPose(double TargetTime, float MaxPredictionTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return Predict(EUxtHandHistoryPose::Grip, EHandKeypoint::Palm, TargetTime, MaxPredictionTime, OutOrientation, OutPosition);
+}
+
+bool FUxtHandPosePredictor::Predict(
+	EUxtHandHistoryPose Pose, EHandKeypoint Joint, double TargetTime, float MaxPredictionTime, FQuat& OutOrientation,
+	FVector& OutPosition) const
+{
+	if (!History.HasPose(Pose))
+	{
+		return false;
+	}
+
+	const FUxtHandHistorySample& Latest = History.GetSample(0);
+	const FTransform LatestPose = Latest.GetPose(Pose, Joint);
+	OutOrientation = LatestPose.GetRotation();
+	OutPosition = LatestPose.GetLocation();
+
+	const double Horizon = FMath::Clamp(TargetTime - Latest.Time, 0.0, (double)MaxPredictionTime);
+	FVector Velocity;
+	FVector AngularVelocity;
+	if (Horizon <= 0.0 || !History.GetLinearVelocity(Pose, VelocityWindow, Velocity, Joint) ||
+		!History.GetAngularVelocity(Pose, VelocityWindow, AngularVelocity, Joint))
+	{
+		return true;
+	}
+
+	OutPosition += Velocity * Horizon;
+
+	// Rotate further about the angular velocity axis, in world space
+	const FVector::FReal AngularSpeed = AngularVelocity.Size();
+	if (AngularSpeed > KINDA_SMALL_NUMBER)
+	{
+		OutOrientation = (FQuat(AngularVelocity / AngularSpeed, AngularSpeed * Horizon) * OutOrientation).GetNormalized();
+	}
+	return true;
+}
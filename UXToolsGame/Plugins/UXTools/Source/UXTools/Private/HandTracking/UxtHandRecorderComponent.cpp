@@ -0,0 +1,47 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandRecorderComponent.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+
+UUxtHandRecorderComponent::UUxtHandRecorderComponent()
+{
+	// Tick before pointers so that the recorded state is the one they see this frame
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = ETickingGroup::TG_PrePhysics;
+}
+
+void UUxtHandRecorderComponent::StartRecording()
+{
+	Recording.Frames.Reset();
+	bIsRecording = true;
+	SetComponentTickEnabled(true);
+}
+
+void UUxtHandRecorderComponent::StopRecording()
+{
+	bIsRecording = false;
+	SetComponentTickEnabled(false);
+}
+
+bool UUxtHandRecorderComponent::SaveRecording(const FString& Filename)
+{
+	return Recording.SaveToFile(Filename);
+}
+
+void UUxtHandRecorderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (bIsRecording)
+	{
+		const IUxtHandTracker& HandTracker = IUxtHandTracker::Get();
+
+		FUxtRecordedFrame& Frame = Recording.Frames.AddDefaulted_GetRef();
+		Frame.DeltaTime = DeltaTime;
+		Frame.LeftHand.Capture(HandTracker, EControllerHand::Left);
+		Frame.RightHand.Capture(HandTracker, EControllerHand::Right);
+	}
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandRecording.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** 'UXHR' */
+	const uint32 RecordingMagic = 0x52485855;
+
+	/** Increase when changing the binary layout of recordings. */
+	const uint32 RecordingVersion = 2;
+
+	enum ERecordedHandFlags : uint8
+	{
+		Tracked = 1 << 0,
+		HandController = 1 << 1,
+		Grabbing = 1 << 2,
+		SelectPressed = 1 << 3,
+		HasJoints = 1 << 4,
+		HasPointerPose = 1 << 5,
+		HasGripPose = 1 << 6,
+	};
+} // namespace
+
+FUxtRecordedHandState::FUxtRecordedHandState()
+	: PointerOrientation(FQuat4f::Identity)
+	, PointerPosition(FVector3f::ZeroVector)
+	, GripOrientation(FQuat4f::Identity)
+	, GripPosition(FVector3f::ZeroVector)
+{
+	for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+	{
+		JointOrientations[Joint] = FQuat4f::Identity;
+		JointPositions[Joint] = FVector3f::ZeroVector;
+		JointRadii[Joint] = 0.0f;
+	}
+}
+
+void FUxtRecordedHandState::Capture(const IUxtHandTracker& HandTracker, EControllerHand Hand)
+{
+	bIsHandController = HandTracker.IsHandController(Hand);
+	bIsTracked = HandTracker.GetTrackingStatus(Hand) != ETrackingStatus::NotTracked;
+	bIsGrabbing = false;
+	bIsSelectPressed = false;
+	bHasJoints = false;
+	bHasPointerPose = false;
+	bHasGripPose = false;
+
+	if (!bIsTracked)
+	{
+		return;
+	}
+
+	// Joints are not available for motion controllers, capture each channel independently
+	FQuat Orientations[EHandKeypointCount];
+	FVector Positions[EHandKeypointCount];
+	float Radii[EHandKeypointCount];
+	bHasJoints = HandTracker.GetAllJointStates(Hand, Orientations, Positions, Radii);
+	if (bHasJoints)
+	{
+		for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+		{
+			JointOrientations[Joint] = FQuat4f(Orientations[Joint]);
+			JointPositions[Joint] = FVector3f(Positions[Joint]);
+			JointRadii[Joint] = Radii[Joint];
+		}
+	}
+
+	FQuat Orientation;
+	FVector Position;
+	bHasPointerPose = HandTracker.GetPointerPose(Hand, Orientation, Position);
+	if (bHasPointerPose)
+	{
+		PointerOrientation = FQuat4f(Orientation);
+		PointerPosition = FVector3f(Position);
+	}
+	bHasGripPose = HandTracker.GetGripPose(Hand, Orientation, Position);
+	if (bHasGripPose)
+	{
+		GripOrientation = FQuat4f(Orientation);
+		GripPosition = FVector3f(Position);
+	}
+
+	HandTracker.GetIsGrabbing(Hand, bIsGrabbing);
+	HandTracker.GetIsSelectPressed(Hand, bIsSelectPressed);
+}
+
+FArchive& operator<<(FArchive& Ar, FUxtRecordedHandState& State)
+{
+	uint8 Flags = 0;
+	Flags |= State.bIsTracked ? ERecordedHandFlags::Tracked : 0;
+	Flags |= State.bIsHandController ? ERecordedHandFlags::HandController : 0;
+	Flags |= State.bIsGrabbing ? ERecordedHandFlags::Grabbing : 0;
+	Flags |= State.bIsSelectPressed ? ERecordedHandFlags::SelectPressed : 0;
+	Flags |= State.bHasJoints ? ERecordedHandFlags::HasJoints : 0;
+	Flags |= State.bHasPointerPose ? ERecordedHandFlags::HasPointerPose : 0;
+	Flags |= State.bHasGripPose ? ERecordedHandFlags::HasGripPose : 0;
+	Ar << Flags;
+
+	State.bIsTracked = (Flags & ERecordedHandFlags::Tracked) != 0;
+	State.bIsHandController = (Flags & ERecordedHandFlags::HandController) != 0;
+	State.bIsGrabbing = (Flags & ERecordedHandFlags::Grabbing) != 0;
+	State.bIsSelectPressed = (Flags & ERecordedHandFlags::SelectPressed) != 0;
+	State.bHasJoints = (Flags & ERecordedHandFlags::HasJoints) != 0;
+	State.bHasPointerPose = (Flags & ERecordedHandFlags::HasPointerPose) != 0;
+	State.bHasGripPose = (Flags & ERecordedHandFlags::HasGripPose) != 0;
+
+	if (State.bHasJoints)
+	{
+		for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+		{
+			Ar << State.JointOrientations[Joint];
+			Ar << State.JointPositions[Joint];
+			Ar << State.JointRadii[Joint];
+		}
+	}
+
+	if (State.bHasPointerPose)
+	{
+		Ar << State.PointerOrientation;
+		Ar << State.PointerPosition;
+	}
+
+	if (State.bHasGripPose)
+	{
+		Ar << State.GripOrientation;
+		Ar << State.GripPosition;
+	}
+
+	return Ar;
+}
+
+const FUxtRecordedHandState& FUxtRecordedFrame::GetHandState(EControllerHand Hand) const
+{
+	return Hand == EControllerHand::Right ? RightHand : LeftHand;
+}
+
+FArchive& operator<<(FArchive& Ar, FUxtRecordedFrame& Frame)
+{
+	Ar << Frame.DeltaTime;
+	Ar << Frame.LeftHand;
+	Ar << Frame.RightHand;
+	return Ar;
+}
+
+void FUxtHandRecording::Serialize(FArchive& Ar)
+{
+	uint32 Magic = RecordingMagic;
+	uint32 Version = RecordingVersion;
+	int32 NumJoints = EHandKeypointCount;
+	Ar << Magic;
+	Ar << Version;
+	Ar << NumJoints;
+
+	if (Magic != RecordingMagic || Version != RecordingVersion || NumJoints != EHandKeypointCount)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << Frames;
+}
+
+bool FUxtHandRecording::SaveToFile(const FString& Filename)
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Serialize(Writer);
+
+	return FFileHelper::SaveArrayToFile(Data, *Filename);
+}
+
+bool FUxtHandRecording::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Filename))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	Serialize(Reader);
+
+	if (Reader.IsError() || !Reader.AtEnd())
+	{
+		Frames.Empty();
+		return false;
+	}
+
+	return true;
+}
@@ -62,6 +62,32 @@ bool UUxtTouchBasedHandTrackerComponent::GetJointState(
 	return bTracked;
 }
 
+bool UUxtTouchBasedHandTrackerComponent::GetAllJointStates(
+	EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions, TArrayView<float> OutRadii) const
+{
+	check(OutOrientations.Num() == EHandKeypointCount && OutPositions.Num() == EHandKeypointCount && OutRadii.Num() == EHandKeypointCount);
+
+	// Deproject the touch position only once for all joints
+	FQuat PointerOrientation;
+	FVector PointerPosition;
+	if (!GetPointerPose(Hand, PointerOrientation, PointerPosition))
+	{
+		return false;
+	}
+
+	for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+	{
+		OutOrientations[Joint] = PointerOrientation;
+		OutPositions[Joint] = PointerPosition;
+		OutRadii[Joint] = 0;
+	}
+
+	// See GetJointState
+	OutOrientations[(int32)EHandKeypoint::Palm] = UUxtFunctionLibrary::GetHeadPose(PlayerController).GetRotation();
+
+	return true;
+}
+
 bool UUxtTouchBasedHandTrackerComponent::GetFingerState(EControllerHand Hand, float& OutScreenX, float& OutScreenY) const
 {
 	ETouchIndex::Type FingerIndex = Hand == EControllerHand::Left ? ETouchIndex::Touch1 : ETouchIndex::Touch2;
@@ -113,3 +139,13 @@ bool UUxtTouchBasedHandTrackerComponent::GetIsSelectPressed(EControllerHand Hand
 	OutIsSelectPressed = IsTouchPressed(Hand) ? true : OutIsSelectPressed;
 	return true;
 }
+
+const FUxtHandFrame& UUxtTouchBasedHandTrackerComponent::GetHandFrame(EControllerHand Hand) const
+{
+	return HandFrameCache.GetHandFrame(*this, Hand);
+}
+
+const FUxtHandHistory& UUxtTouchBasedHandTrackerComponent::GetHandHistory(EControllerHand Hand) const
+{
+	return HandFrameCache.GetHandHistory(*this, Hand);
+}
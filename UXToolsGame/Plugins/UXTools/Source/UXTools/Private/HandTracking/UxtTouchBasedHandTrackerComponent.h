@@ -8,6 +8,7 @@
 
 #include "Components/ActorComponent.h"
 #include "HandTracking/IUxtHandTracker.h"
+#include "HandTracking/UxtHandFrameCache.h"
 
 #include "UxtTouchBasedHandTrackerComponent.generated.h"
 
@@ -34,10 +35,15 @@ public:
 	virtual bool IsHandController(EControllerHand Hand) const override;
 	virtual bool GetJointState(
 		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const override;
+	virtual bool GetAllJointStates(
+		EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions,
+		TArrayView<float> OutRadii) const override;
 	virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
 	virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
 	virtual bool GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const override;
 	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override;
+	virtual const FUxtHandFrame& GetHandFrame(EControllerHand Hand) const override;
+	virtual const FUxtHandHistory& GetHandHistory(EControllerHand Hand) const override;
 
 	// UActorComponent
 	virtual void BeginPlay() override;
@@ -51,4 +57,7 @@ private:
 	APlayerController* PlayerController;
 
 	IUxtHandTracker* OldHandTracker = nullptr;
+
+	/** Hand frames and histories captured from the touch state, the histories provide hand velocities. Poses are not predicted. */
+	mutable FUxtHandFrameCache HandFrameCache;
 };
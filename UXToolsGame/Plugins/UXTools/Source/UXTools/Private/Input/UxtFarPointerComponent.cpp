@@ -9,12 +9,14 @@
 #include "Components/PrimitiveComponent.h"
 #include "Engine/World.h"
 #include "HandTracking/IUxtHandTracker.h"
+#include "Input/UxtFarPointerQuerySubsystem.h"
 #include "Input/UxtInputSubsystem.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
+#include "Interactions/UxtClosestPointQuery.h"
 #include "Interactions/UxtFarTarget.h"
 #include "Interactions/UxtInteractionUtils.h"
-#include "Materials/MaterialParameterCollectionInstance.h"
-#include "UObject/ConstructorHelpers.h"
 #include "Utils/UxtFunctionLibrary.h"
+#include "Utils/UxtParameterCollectionSubsystem.h"
 #include "VisualLogger/VisualLogger.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUxtFarPointer, Log, All);
@@ -22,12 +24,30 @@ DEFINE_LOG_CATEGORY_STATIC(LogUxtFarPointer, Log, All);
 UUxtFarPointerComponent::UUxtFarPointerComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
-	static ConstructorHelpers::FObjectFinder<UMaterialParameterCollection> Finder(TEXT("/UXTools/Materials/MPC_UXSettings"));
-	ParameterCollection = Finder.Object;
 	// Tick before controls
 	PrimaryComponentTick.TickGroup = ETickingGroup::TG_PrePhysics;
 }
 
+void UUxtFarPointerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UUxtFarPointerQuerySubsystem* QuerySubsystem = GetWorld()->GetSubsystem<UUxtFarPointerQuerySubsystem>())
+	{
+		QuerySubsystem->RegisterPointer(this);
+	}
+}
+
+void UUxtFarPointerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UUxtFarPointerQuerySubsystem* QuerySubsystem = GetWorld()->GetSubsystem<UUxtFarPointerQuerySubsystem>())
+	{
+		QuerySubsystem->UnregisterPointer(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UUxtFarPointerComponent::SetActive(bool bNewActive, bool bReset)
 {
 	Super::SetActive(bNewActive, bReset);
@@ -92,8 +112,13 @@ FTransform UUxtFarPointerComponent::GetCursorTransform() const
 }
 
 // Finds the far target a primitive belongs to, if any
-static UObject* FindFarTarget(UPrimitiveComponent* Primitive)
+static UObject* FindFarTarget(UWorld* World, UPrimitiveComponent* Primitive)
 {
+	if (UUxtFarPointerQuerySubsystem* QuerySubsystem = World->GetSubsystem<UUxtFarPointerQuerySubsystem>())
+	{
+		return QuerySubsystem->FindFarTarget(Primitive);
+	}
+
 	if (Primitive && Primitive->GetOwner())
 	{
 		for (UActorComponent* Component : Primitive->GetOwner()->GetComponents())
@@ -108,6 +133,32 @@ static UObject* FindFarTarget(UPrimitiveComponent* Primitive)
 	return nullptr;
 }
 
+void UUxtFarPointerComponent::CalcRay(const FQuat& Orientation, const FVector& Origin, FVector& OutStart, FVector& OutEnd) const
+{
+	const FVector Forward = Orientation.GetForwardVector();
+	OutStart = Origin + Forward * RayStartOffset;
+	OutEnd = OutStart + Forward * RayLength;
+}
+
+bool UUxtFarPointerComponent::GetBatchedRay(FVector& OutStart, FVector& OutEnd) const
+{
+	// Pointers tracing cached candidates or locked to their target don't trace the scene
+	if (!bUseBatchedRayQuery || bReuseRayQuery || bUseAsyncRayQuery || bFocusLocked || !IsActive())
+	{
+		return false;
+	}
+
+	FQuat Orientation;
+	FVector Origin;
+	if (!IUxtHandTracker::Get().GetPointerPose(Hand, Orientation, Origin))
+	{
+		return false;
+	}
+
+	CalcRay(Orientation, Origin, OutStart, OutEnd);
+	return true;
+}
+
 void UUxtFarPointerComponent::OnPointerPoseUpdated(const FQuat& NewOrientation, const FVector& NewOrigin)
 {
 	PointerOrientation = NewOrientation;
@@ -139,12 +190,22 @@ void UUxtFarPointerComponent::OnPointerPoseUpdated(const FQuat& NewOrientation,
 		// Line trace to find new primitive
 		FHitResult Hit;
 		const FVector Forward = PointerOrientation.GetForwardVector();
-		FVector Start = PointerOrigin + Forward * RayStartOffset;
-		FVector End = Start + Forward * RayLength;
+		FVector Start, End;
+		CalcRay(PointerOrientation, PointerOrigin, Start, End);
 
-		// Query for simple collision volumes
-		FCollisionQueryParams QueryParams(NAME_None, false);
-		GetWorld()->LineTraceSingleByChannel(Hit, Start, End, TraceChannel, QueryParams);
+		// Use the result of the batched traces of this frame if available
+		UUxtFarPointerQuerySubsystem* QuerySubsystem = GetWorld()->GetSubsystem<UUxtFarPointerQuerySubsystem>();
+		if (!bUseBatchedRayQuery || !QuerySubsystem || !QuerySubsystem->GetRayHit(this, Start, End, Hit))
+		{
+			TraceRay(Start, End, Hit);
+		}
+
+		if (bUseConeCast)
+		{
+			ConeCast(Start, End, Hit);
+		}
+
+		ApplyFocusHysteresis(Start, End, Hit);
 
 		NewPrimitive = Hit.GetComponent();
 
@@ -161,7 +222,7 @@ void UUxtFarPointerComponent::OnPointerPoseUpdated(const FQuat& NewOrientation,
 
 			// Update hit primitive and far target
 			HitPrimitiveWeak = NewPrimitive;
-			FarTargetWeak = FindFarTarget(NewPrimitive);
+			FarTargetWeak = FindFarTarget(GetWorld(), NewPrimitive);
 		}
 
 		// Update cached hit info
@@ -205,6 +266,307 @@ void UUxtFarPointerComponent::OnPointerPoseUpdated(const FQuat& NewOrientation,
 #endif // ENABLE_VISUAL_LOG
 }
 
+bool UUxtFarPointerComponent::TraceRay(const FVector& Start, const FVector& End, FHitResult& OutHit)
+{
+	// Query for simple collision volumes
+	FCollisionQueryParams QueryParams(NAME_None, false);
+
+	if (!bReuseRayQuery && !bUseAsyncRayQuery)
+	{
+		RayCandidates.Reset();
+		return GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, TraceChannel, QueryParams);
+	}
+
+	if (bUseAsyncRayQuery)
+	{
+		ConsumeAsyncRayQuery();
+	}
+
+	// Query synchronously if the ray has moved out of the volume covered by the candidates
+	if (!CanReuseRayCandidates(Start, End))
+	{
+		RayCandidatesStart = Start;
+		RayCandidatesEnd = End;
+		RayCandidatesMargin = FMath::Max(RayQueryMargin, 0.0f);
+		RayCandidatesTime = GetWorld()->GetTimeSeconds();
+		RayCandidatesChannel = TraceChannel;
+
+		FVector CapsuleCenter;
+		FQuat CapsuleRotation;
+		const FCollisionShape Capsule = MakeRayCapsule(Start, End, RayCandidatesMargin, CapsuleCenter, CapsuleRotation);
+
+		RayOverlaps.Reset();
+		GetWorld()->OverlapMultiByChannel(RayOverlaps, CapsuleCenter, CapsuleRotation, TraceChannel, Capsule, QueryParams);
+		SetRayCandidates(RayOverlaps);
+	}
+
+	// Trace against the candidates only and keep the closest hit
+	bool bHasHit = false;
+	for (const TWeakObjectPtr<UPrimitiveComponent>& Candidate : RayCandidates)
+	{
+		UPrimitiveComponent* Primitive = Candidate.Get();
+		FHitResult CandidateHit;
+		if (Primitive && Primitive->LineTraceComponent(CandidateHit, Start, End, QueryParams))
+		{
+			if (!bHasHit || CandidateHit.Time < OutHit.Time)
+			{
+				OutHit = CandidateHit;
+				bHasHit = true;
+			}
+		}
+	}
+
+	if (bUseAsyncRayQuery)
+	{
+		RequestAsyncRayQuery(Start, End);
+	}
+	else
+	{
+		AsyncRayQuery = FTraceHandle();
+	}
+
+	return bHasHit;
+}
+
+void UUxtFarPointerComponent::ConeCast(const FVector& Start, const FVector& End, FHitResult& InOutHit)
+{
+	UUxtTargetRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UUxtTargetRegistrySubsystem>();
+	if (!Registry || RayLength <= 0.0f)
+	{
+		return;
+	}
+
+	const FVector Direction = (End - Start).GetSafeNormal();
+	const float ConeAngleRad = FMath::DegreesToRadians(FMath::Max(ConeCastAngle, KINDA_SMALL_NUMBER));
+	const float Hysteresis = FMath::Clamp(ConeCastHysteresis, 0.0f, 1.0f);
+	const UPrimitiveComponent* FocusedPrimitive = GetHitPrimitive();
+
+	// Lower scores are better, the focused primitive is favored by the hysteresis
+	auto Score = [&](const UPrimitiveComponent* Primitive, float Angle, float Depth)
+	{
+		const float Value = Angle / ConeAngleRad + ConeCastDepthWeight * Depth / RayLength;
+		return Primitive == FocusedPrimitive ? Value * (1.0f - Hysteresis) : Value;
+	};
+
+	// The primitive hit by the ray is a candidate at zero angle if it is a far target
+	UPrimitiveComponent* HitPrimitive = InOutHit.GetComponent();
+	UPrimitiveComponent* BestPrimitive = nullptr;
+	FVector BestPoint = FVector::ZeroVector;
+	float BestScore = MAX_flt;
+	if (HitPrimitive && FindFarTarget(GetWorld(), HitPrimitive))
+	{
+		BestPrimitive = HitPrimitive;
+		BestScore = Score(HitPrimitive, 0.0f, InOutHit.Distance);
+	}
+
+	// Primitives behind the hit are occluded
+	const float MaxDepth = InOutHit.bBlockingHit ? InOutHit.Distance : RayLength;
+	Registry->QueryCone(Start, Direction, MaxDepth, ConeAngleRad * (1.0f + Hysteresis), TraceChannel, ConeCandidates);
+
+	for (const FUxtConeQueryCandidate& Candidate : ConeCandidates)
+	{
+		// The angle to the bounds bounds the score from below, skip candidates that can't improve on the best one
+		if (Candidate.Primitive == HitPrimitive || Score(Candidate.Primitive, Candidate.Angle, 0.0f) >= BestScore)
+		{
+			continue;
+		}
+
+		// Measure the angle to the collision closest to the ray point at the depth of the bounds
+		const FVector RayPoint = Start + Direction * Candidate.Depth;
+		FVector ClosestPoint;
+		float DistanceSqr;
+		if (!FUxtClosestPointQuery::GetClosestPoint(Candidate.Primitive, RayPoint, ClosestPoint, DistanceSqr))
+		{
+			continue;
+		}
+
+		const FVector ToClosestPoint = ClosestPoint - Start;
+		const float Depth = FVector::DotProduct(ToClosestPoint, Direction);
+		if (Depth < 0.0f || Depth > MaxDepth)
+		{
+			continue;
+		}
+
+		const float Angle = FMath::Acos(FMath::Clamp(FVector::DotProduct(ToClosestPoint.GetSafeNormal(), Direction), -1.0f, 1.0f));
+		const float MaxAngle = Candidate.Primitive == FocusedPrimitive ? ConeAngleRad * (1.0f + Hysteresis) : ConeAngleRad;
+		const float CandidateScore = Score(Candidate.Primitive, Angle, Depth);
+		if (Angle <= MaxAngle && CandidateScore < BestScore && FindFarTarget(GetWorld(), Candidate.Primitive))
+		{
+			BestPrimitive = Candidate.Primitive;
+			BestPoint = ClosestPoint;
+			BestScore = CandidateScore;
+		}
+	}
+
+	if (BestPrimitive && BestPrimitive != HitPrimitive)
+	{
+		InOutHit = MakeClosestPointHit(BestPrimitive, Start, End, BestPoint);
+	}
+}
+
+void UUxtFarPointerComponent::ApplyFocusHysteresis(const FVector& Start, const FVector& End, FHitResult& InOutHit)
+{
+	UPrimitiveComponent* FocusedPrimitive = GetHitPrimitive();
+	UPrimitiveComponent* NewPrimitive = InOutHit.GetComponent();
+
+	// Hysteresis only applies when switching from the focused far target to another one
+	const bool bIsSwitch = FocusedPrimitive && NewPrimitive && NewPrimitive != FocusedPrimitive && GetFarTarget() &&
+						   FindFarTarget(GetWorld(), NewPrimitive);
+	if (!bIsSwitch || (FocusSwitchMargin <= 0.0f && FocusSwitchDwellTime <= 0.0f))
+	{
+		PendingFocusPrimitiveWeak = nullptr;
+		return;
+	}
+
+	// Keep the focused primitive while the ray passes within the margin of it, measured around the new hit
+	bool bKeepFocus = false;
+	FVector ClosestPoint;
+	float DistanceSqr;
+	if (FUxtClosestPointQuery::GetClosestPoint(FocusedPrimitive, InOutHit.Location, ClosestPoint, DistanceSqr))
+	{
+		const FVector Direction = (End - Start).GetSafeNormal();
+		const FVector RayPoint = Start + Direction * FVector::DotProduct(ClosestPoint - Start, Direction);
+		bKeepFocus = FVector::DistSquared(RayPoint, ClosestPoint) <= FMath::Square(FocusSwitchMargin);
+
+		if (bKeepFocus)
+		{
+			PendingFocusPrimitiveWeak = nullptr;
+		}
+		else if (FocusSwitchDwellTime > 0.0f)
+		{
+			// Switch once the new primitive has been hit for the dwell time
+			const float Time = GetWorld()->GetTimeSeconds();
+			if (PendingFocusPrimitiveWeak.Get() != NewPrimitive)
+			{
+				PendingFocusPrimitiveWeak = NewPrimitive;
+				PendingFocusTime = Time;
+			}
+			bKeepFocus = Time - PendingFocusTime < FocusSwitchDwellTime;
+		}
+	}
+
+	if (bKeepFocus)
+	{
+		// Prefer the actual ray hit if the focused primitive is still on the ray, e.g. behind the new hit
+		FHitResult FocusedHit;
+		FCollisionQueryParams QueryParams(NAME_None, false);
+		if (FocusedPrimitive->LineTraceComponent(FocusedHit, Start, End, QueryParams))
+		{
+			InOutHit = FocusedHit;
+		}
+		else
+		{
+			InOutHit = MakeClosestPointHit(FocusedPrimitive, Start, End, ClosestPoint);
+		}
+	}
+	else
+	{
+		PendingFocusPrimitiveWeak = nullptr;
+	}
+}
+
+FHitResult UUxtFarPointerComponent::MakeClosestPointHit(
+	UPrimitiveComponent* Primitive, const FVector& Start, const FVector& End, const FVector& Point)
+{
+	// Hit the primitive at the given point, facing the ray
+	const FVector Direction = (End - Start).GetSafeNormal();
+	const FVector RayPoint = Start + Direction * FVector::DotProduct(Point - Start, Direction);
+	FVector Normal = (RayPoint - Point).GetSafeNormal();
+	if (Normal.IsZero())
+	{
+		Normal = -Direction;
+	}
+
+	FHitResult Hit(Primitive->GetOwner(), Primitive, Point, Normal);
+	Hit.bBlockingHit = true;
+	Hit.TraceStart = Start;
+	Hit.TraceEnd = End;
+	Hit.Distance = FVector::Dist(Start, Point);
+	Hit.Time = Hit.Distance / FMath::Max(FVector::Dist(Start, End), KINDA_SMALL_NUMBER);
+	return Hit;
+}
+
+FCollisionShape UUxtFarPointerComponent::MakeRayCapsule(
+	const FVector& Start, const FVector& End, float Margin, FVector& OutCenter, FQuat& OutRotation)
+{
+	// Capsule enclosing all points within the margin of the ray
+	const FVector Segment = End - Start;
+	OutCenter = Start + 0.5f * Segment;
+	OutRotation = FQuat::FindBetweenNormals(FVector::UpVector, Segment.GetSafeNormal(SMALL_NUMBER, FVector::UpVector));
+	return FCollisionShape::MakeCapsule(Margin, 0.5f * Segment.Size() + Margin);
+}
+
+void UUxtFarPointerComponent::SetRayCandidates(const TArray<FOverlapResult>& Overlaps)
+{
+	// Only blocking primitives can stop the line trace
+	RayCandidates.Reset(Overlaps.Num());
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		UPrimitiveComponent* Primitive = Overlap.GetComponent();
+		if (Primitive && Primitive->GetCollisionResponseToChannel(TraceChannel) == ECR_Block)
+		{
+			RayCandidates.AddUnique(Primitive);
+		}
+	}
+}
+
+void UUxtFarPointerComponent::RequestAsyncRayQuery(const FVector& Start, const FVector& End)
+{
+	AsyncRayQueryStart = Start;
+	AsyncRayQueryEnd = End;
+	AsyncRayQueryMargin = FMath::Max(RayQueryMargin, 0.0f);
+	AsyncRayQueryTime = GetWorld()->GetTimeSeconds();
+	AsyncRayQueryChannel = TraceChannel;
+
+	FVector CapsuleCenter;
+	FQuat CapsuleRotation;
+	const FCollisionShape Capsule = MakeRayCapsule(Start, End, AsyncRayQueryMargin, CapsuleCenter, CapsuleRotation);
+
+	FCollisionQueryParams QueryParams(NAME_None, false);
+	AsyncRayQuery = GetWorld()->AsyncOverlapByChannel(CapsuleCenter, CapsuleRotation, TraceChannel, Capsule, QueryParams);
+}
+
+void UUxtFarPointerComponent::ConsumeAsyncRayQuery()
+{
+	if (!AsyncRayQuery.IsValid())
+	{
+		return;
+	}
+
+	// Results of queries requested in the previous frame are available now, older results have been discarded
+	FOverlapDatum Datum;
+	const bool bHasResults = GetWorld()->QueryOverlapData(AsyncRayQuery, Datum);
+	AsyncRayQuery = FTraceHandle();
+
+	if (bHasResults)
+	{
+		RayCandidatesStart = AsyncRayQueryStart;
+		RayCandidatesEnd = AsyncRayQueryEnd;
+		RayCandidatesMargin = AsyncRayQueryMargin;
+		RayCandidatesTime = AsyncRayQueryTime;
+		RayCandidatesChannel = AsyncRayQueryChannel;
+		SetRayCandidates(Datum.OutOverlaps);
+	}
+}
+
+bool UUxtFarPointerComponent::CanReuseRayCandidates(const FVector& Start, const FVector& End) const
+{
+	if (RayCandidatesMargin < 0.0f || RayCandidatesChannel != TraceChannel)
+	{
+		return false;
+	}
+
+	if (GetWorld()->GetTimeSeconds() - RayCandidatesTime > MaxRayQueryInterval)
+	{
+		return false;
+	}
+
+	// Every point of the ray is at most as far from the cached ray as the farthest of its end points,
+	// so the ray stays inside the expanded query volume if both end points are within the margin.
+	const float MarginSqr = FMath::Square(RayCandidatesMargin);
+	return FVector::DistSquared(Start, RayCandidatesStart) <= MarginSqr && FVector::DistSquared(End, RayCandidatesEnd) <= MarginSqr;
+}
+
 void UUxtFarPointerComponent::SetPressed(bool bNewPressed)
 {
 	if (bPressed != bNewPressed)
@@ -302,19 +664,9 @@ UObject* UUxtFarPointerComponent::GetFarTarget() const
 
 void UUxtFarPointerComponent::UpdateParameterCollection(FVector IndexTipPosition)
 {
-	if (ParameterCollection)
+	if (UUxtParameterCollectionSubsystem* ParameterCollection = GetWorld()->GetSubsystem<UUxtParameterCollectionSubsystem>())
 	{
-		UMaterialParameterCollectionInstance* ParameterCollectionInstance = GetWorld()->GetParameterCollectionInstance(ParameterCollection);
-		static FName ParameterNames[] = {"LeftPointerPosition", "RightPointerPosition"};
-		FName ParameterName = Hand == EControllerHand::Left ? ParameterNames[0] : ParameterNames[1];
-		const bool bFoundParameter = ParameterCollectionInstance->SetVectorParameterValue(ParameterName, IndexTipPosition);
-
-		if (!bFoundParameter)
-		{
-			UE_LOG(
-				UXTools, Warning, TEXT("Unable to find %s parameter in material parameter collection %s."), *ParameterName.ToString(),
-				*ParameterCollection->GetPathName());
-		}
+		ParameterCollection->SetPointerPosition(Hand, IndexTipPosition);
 	}
 }
 
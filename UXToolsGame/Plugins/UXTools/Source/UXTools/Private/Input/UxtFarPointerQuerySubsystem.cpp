@@ -0,0 +1,146 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Input/UxtFarPointerQuerySubsystem.h"
+
+#include "CollisionQueryParams.h"
+
+#include "Async/ParallelFor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
+#include "Interactions/UxtFarTarget.h"
+
+void UUxtFarPointerQuerySubsystem::Deinitialize()
+{
+	Pointers.Empty();
+	Rays.Empty();
+	FarTargets.Empty();
+	RaysFrame = MAX_uint64;
+
+	Super::Deinitialize();
+}
+
+void UUxtFarPointerQuerySubsystem::RegisterPointer(UUxtFarPointerComponent* Pointer)
+{
+	Pointers.AddUnique(Pointer);
+}
+
+void UUxtFarPointerQuerySubsystem::UnregisterPointer(UUxtFarPointerComponent* Pointer)
+{
+	Pointers.Remove(Pointer);
+
+	// Rays of the current frame may still refer to the pointer
+	Rays.RemoveAll([Pointer](const FPointerRay& Ray) { return Ray.Pointer == Pointer; });
+}
+
+bool UUxtFarPointerQuerySubsystem::GetRayHit(
+	const UUxtFarPointerComponent* Pointer, const FVector& Start, const FVector& End, FHitResult& OutHit)
+{
+	if (RaysFrame != GFrameCounter)
+	{
+		RaysFrame = GFrameCounter;
+		TraceRays();
+	}
+
+	for (const FPointerRay& Ray : Rays)
+	{
+		if (Ray.Pointer == Pointer)
+		{
+			// The pointer's pose or settings may have changed since the rays were gathered
+			if (Ray.Start != Start || Ray.End != End || Ray.TraceChannel != Pointer->TraceChannel)
+			{
+				return false;
+			}
+
+			OutHit = Ray.Hit;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+UObject* UUxtFarPointerQuerySubsystem::FindFarTarget(UPrimitiveComponent* Primitive)
+{
+	if (!Primitive || !Primitive->GetOwner())
+	{
+		return nullptr;
+	}
+
+	// Targets found in previous frames are stale, the map is only cleared when rays are traced again
+	if (RaysFrame == GFrameCounter)
+	{
+		if (const TWeakObjectPtr<UObject>* FarTarget = FarTargets.Find(Primitive))
+		{
+			return FarTarget->Get();
+		}
+	}
+
+	UObject* FarTarget = nullptr;
+	if (UUxtTargetRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UUxtTargetRegistrySubsystem>())
+	{
+		for (const TWeakObjectPtr<UActorComponent>& ComponentWeak :
+			 Registry->GetCachedComponents(Primitive->GetOwner(), UUxtFarTarget::StaticClass()))
+		{
+			UActorComponent* Component = ComponentWeak.Get();
+			if (Component && IUxtFarTarget::Execute_IsFarFocusable(Component, Primitive))
+			{
+				FarTarget = Component;
+				break;
+			}
+		}
+	}
+	else
+	{
+		for (UActorComponent* Component : Primitive->GetOwner()->GetComponents())
+		{
+			if (Component->Implements<UUxtFarTarget>() && IUxtFarTarget::Execute_IsFarFocusable(Component, Primitive))
+			{
+				FarTarget = Component;
+				break;
+			}
+		}
+	}
+
+	// Focusability may change over time, only share the result within the frame
+	if (RaysFrame == GFrameCounter)
+	{
+		FarTargets.Add(Primitive, FarTarget);
+	}
+
+	return FarTarget;
+}
+
+void UUxtFarPointerQuerySubsystem::TraceRays()
+{
+	Rays.Reset();
+	FarTargets.Reset();
+
+	Pointers.RemoveAll([](const TWeakObjectPtr<UUxtFarPointerComponent>& Pointer) { return !Pointer.IsValid(); });
+
+	for (const TWeakObjectPtr<UUxtFarPointerComponent>& PointerWeak : Pointers)
+	{
+		const UUxtFarPointerComponent* Pointer = PointerWeak.Get();
+		FVector Start, End;
+		if (Pointer->GetBatchedRay(Start, End))
+		{
+			Rays.Add({Pointer, Start, End, Pointer->TraceChannel, FHitResult()});
+		}
+	}
+
+	// Query for simple collision volumes, as the pointers do
+	const FCollisionQueryParams QueryParams(NAME_None, false);
+	const UWorld* World = GetWorld();
+
+	// Scene queries only read the physics scene, which is not simulating while pointers tick
+	ParallelFor(
+		Rays.Num(),
+		[this, World, &QueryParams](int32 Index)
+		{
+			FPointerRay& Ray = Rays[Index];
+			World->LineTraceSingleByChannel(Ray.Hit, Ray.Start, Ray.End, Ray.TraceChannel, QueryParams);
+		},
+		Rays.Num() < MinParallelRays);
+}
@@ -42,14 +42,6 @@ AUxtHandInteractionActor::AUxtHandInteractionActor(const FObjectInitializer& Obj
 	ProximityTrigger->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	ProximityTrigger->SetCollisionProfileName(TEXT("UI"));
 	ProximityTrigger->SetupAttachment(GetRootComponent());
-
-	// Zero out the velocity caches.
-	// FVector's default constructor doesn't zero initialize it.
-	for (int i = 0; i < VelocityUpdateInterval; ++i)
-	{
-		VelocityPositionsCache[i] = FVector::ZeroVector;
-		VelocityNormalsCache[i] = FVector::ZeroVector;
-	}
 }
 
 // Called when the game starts or when spawned
@@ -61,6 +53,7 @@ void AUxtHandInteractionActor::BeginPlay()
 	NearPointer->Hand = Hand;
 	NearPointer->TraceChannel = TraceChannel;
 	NearPointer->PokeRadius = PokeRadius;
+	NearPointer->bUseTargetRegistry = bUseTargetRegistry;
 	FarPointer->Hand = Hand;
 	FarPointer->TraceChannel = TraceChannel;
 	FarPointer->RayStartOffset = RayStartOffset;
@@ -125,33 +118,17 @@ void AUxtHandInteractionActor::UpdateProximityMesh()
 	ProximityTrigger->SetMobility(bRenderProximityMesh ? EComponentMobility::Movable : EComponentMobility::Stationary);
 }
 
-void AUxtHandInteractionActor::UpdateVelocity(float DeltaTime)
+void AUxtHandInteractionActor::UpdateVelocity()
 {
-	FVector Position;
-	FQuat Orientation;
-	if (IUxtHandTracker::Get().GetGripPose(Hand, Orientation, Position))
-	{
-		const FVector Normal = -Orientation.GetUpVector();
-
-		const int FrameIndex = CurrentFrame % VelocityUpdateInterval;
-
-		const FVector NewPositionsSum = VelocityPositionsSum - VelocityPositionsCache[FrameIndex] + Position;
-		const FVector NewNormalsSum = VelocityNormalsSum - VelocityNormalsCache[FrameIndex] + Normal;
-
-		const int CurrentInterval = CurrentFrame < VelocityUpdateInterval ? CurrentFrame : VelocityUpdateInterval;
-		Velocity = (NewPositionsSum - VelocityPositionsSum) / DeltaTime / CurrentInterval;
-
-		const FQuat Rotation = ((NewNormalsSum / CurrentInterval) - (VelocityNormalsSum / CurrentInterval)).ToOrientationQuat();
-		const FVector RotationRate = FMath::DegreesToRadians(Rotation.Euler());
-		AngularVelocity = RotationRate / DeltaTime;
+	// Velocities keep their last value while the history is too short to estimate them, e.g. when tracking is lost
+	const FUxtHandHistory& History = IUxtHandTracker::Get().GetHandHistory(Hand);
+	History.GetLinearVelocity(EUxtHandHistoryPose::Grip, VelocityTimeWindow, Velocity);
 
-		VelocityPositionsCache[FrameIndex] = Position;
-		VelocityPositionsSum = NewPositionsSum;
-		VelocityNormalsCache[FrameIndex] = Normal;
-		VelocityNormalsSum = NewNormalsSum;
+	FVector AngularVelocityRadians;
+	if (History.GetAngularVelocity(EUxtHandHistoryPose::Grip, VelocityTimeWindow, AngularVelocityRadians))
+	{
+		AngularVelocity = FMath::RadiansToDegrees(AngularVelocityRadians);
 	}
-
-	++CurrentFrame;
 }
 
 bool AUxtHandInteractionActor::QueryProximityVolume(bool& OutHasNearTarget)
@@ -167,15 +144,13 @@ bool AUxtHandInteractionActor::QueryProximityVolume(bool& OutHasNearTarget)
 	// otherwise near interaction is disabled and only far interaction used.
 	if (IUxtHandTracker::Get().IsHandController(Hand))
 	{
-		FQuat IndexTipOrientation, PalmOrientation;
-		FVector IndexTipPosition, PalmPosition;
-		float IndexTipRadius, PalmRadius;
-		const bool bIsIndexTipValid =
-			IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius);
-		const bool bIsPalmValid =
-			IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::Palm, PalmOrientation, PalmPosition, PalmRadius);
+		const FUxtHandFrame& HandFrame = IUxtHandTracker::Get().GetHandFrame(Hand);
 		// We've checked for valid hand data above
-		check(bIsIndexTipValid && bIsPalmValid);
+		check(HandFrame.HasJoints());
+
+		const FQuat& PalmOrientation = HandFrame.GetJointOrientation(EHandKeypoint::Palm);
+		const FVector& PalmPosition = HandFrame.GetJointPosition(EHandKeypoint::Palm);
+		const FVector& IndexTipPosition = HandFrame.GetJointPosition(EHandKeypoint::IndexTip);
 
 		const FVector PalmForward = PalmOrientation.GetForwardVector();
 		const FVector PalmToIndex = IndexTipPosition - PalmPosition;
@@ -277,7 +252,7 @@ void AUxtHandInteractionActor::Tick(float DeltaTime)
 		FarPointer->SetActive(bNewFarPointerActive);
 	}
 
-	UpdateVelocity(DeltaTime);
+	UpdateVelocity();
 }
 
 void AUxtHandInteractionActor::SetHand(EControllerHand NewHand)
@@ -314,37 +289,8 @@ void AUxtHandInteractionActor::SetRayLength(float NewRayLength)
 
 bool AUxtHandInteractionActor::IsInPointingPose() const
 {
-	constexpr float PointerBeamBackwardTolerance = 0.5f;
-	constexpr float PointerBeamUpwardTolerance = 0.8f;
-
-	FQuat PalmOrientation;
-	FVector PalmPosition;
-	float PalmRadius;
-
-	if (IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::Palm, PalmOrientation, PalmPosition, PalmRadius))
-	{
-		FVector PalmNormal = PalmOrientation * FVector::DownVector;
-		PalmNormal.Normalize();
-
-		if (PointerBeamBackwardTolerance >= 0)
-		{
-			FVector CameraBackward = -UUxtFunctionLibrary::GetHeadPose(GetWorld()).GetRotation().GetForwardVector();
-			if (FVector::DotProduct(PalmNormal, CameraBackward) > PointerBeamBackwardTolerance)
-			{
-				return false;
-			}
-		}
-
-		if (PointerBeamUpwardTolerance >= 0)
-		{
-			if (FVector::DotProduct(PalmNormal, FVector::UpVector) > PointerBeamUpwardTolerance)
-			{
-				return false;
-			}
-		}
-	}
-
-	return true;
+	const FVector ViewForward = UUxtFunctionLibrary::GetHeadPose(GetWorld()).GetRotation().GetForwardVector();
+	return IUxtHandTracker::Get().GetHandFrame(Hand).IsInPointingPose(ViewForward);
 }
 
 #if ENABLE_VISUAL_LOG
@@ -364,16 +310,18 @@ void AUxtHandInteractionActor::VLogHandJoints() const
 
 	IUxtHandTracker& HandTracker = IUxtHandTracker::Get();
 
+	FQuat JointOrientations[EHandKeypointCount];
+	FVector JointPositions[EHandKeypointCount];
+	float JointRadii[EHandKeypointCount];
+	const bool bHasJoints = HandTracker.GetAllJointStates(Hand, JointOrientations, JointPositions, JointRadii);
+
 	// Hand label at the wrist position
+	if (bHasJoints)
 	{
-		FVector WristPosition;
-		FQuat WristOrientation;
-		float WristRadius;
-		if (HandTracker.GetJointState(Hand, EHandKeypoint::Wrist, WristOrientation, WristPosition, WristRadius))
-		{
-			FString VLogHand = (Hand == EControllerHand::Left) ? TEXT("Left") : TEXT("Right");
-			UE_VLOG_LOCATION(this, LogUxtHandTracking, Log, WristPosition, 0.0f, VLogColorHandJoints, TEXT("%s Hand"), *VLogHand);
-		}
+		FString VLogHand = (Hand == EControllerHand::Left) ? TEXT("Left") : TEXT("Right");
+		UE_VLOG_LOCATION(
+			this, LogUxtHandTracking, Log, JointPositions[(int32)EHandKeypoint::Wrist], 0.0f, VLogColorHandJoints, TEXT("%s Hand"),
+			*VLogHand);
 	}
 
 	// Coordinate axes of the pointer pose
@@ -393,15 +341,13 @@ void AUxtHandInteractionActor::VLogHandJoints() const
 	};
 
 	// Utility function for drawing a bone segment
-	auto VlogJointSegment = [this, &HandTracker](EHandKeypoint JointA, EHandKeypoint JointB)
+	auto VlogJointSegment = [this, bHasJoints, &JointPositions](EHandKeypoint JointA, EHandKeypoint JointB)
 	{
-		FVector PositionA, PositionB;
-		FQuat OrientationA, OrientationB;
-		float RadiusA, RadiusB;
-		if (HandTracker.GetJointState(Hand, JointA, OrientationA, PositionA, RadiusA) &&
-			HandTracker.GetJointState(Hand, JointB, OrientationB, PositionB, RadiusB))
+		if (bHasJoints)
 		{
-			UE_VLOG_SEGMENT_THICK(this, LogUxtHandTracking, Log, PositionA, PositionB, VLogColorHandJoints, 5.0f, TEXT(""));
+			UE_VLOG_SEGMENT_THICK(
+				this, LogUxtHandTracking, Log, JointPositions[(int32)JointA], JointPositions[(int32)JointB], VLogColorHandJoints, 5.0f,
+				TEXT(""));
 		}
 	};
 
@@ -3,8 +3,11 @@
 
 #include "Input/UxtInputSubsystem.h"
 
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Interactions/UxtFarHandler.h"
 #include "Interactions/UxtGrabHandler.h"
 #include "Interactions/UxtPokeHandler.h"
@@ -181,6 +184,33 @@ void UUxtInputSubsystem::RaiseEndPoke(UPrimitiveComponent* Target, UUxtNearPoint
 		Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnEndPoke(Handler, Pointer); });
 }
 
+void UUxtInputSubsystem::ForEachHandlerComponent(
+	AActor* Owner, UClass* HandlerClass, TFunctionRef<void(UActorComponent*)> Callback) const
+{
+	// The registry is a world subsystem, so it is resolved from the owner's world rather than stored on this subsystem.
+	UWorld* World = Owner->GetWorld();
+	if (UUxtTargetRegistrySubsystem* TargetRegistry = World ? World->GetSubsystem<UUxtTargetRegistrySubsystem>() : nullptr)
+	{
+		for (const TWeakObjectPtr<UActorComponent>& ComponentWeak : TargetRegistry->GetCachedComponents(Owner, HandlerClass))
+		{
+			if (UActorComponent* Component = ComponentWeak.Get())
+			{
+				Callback(Component);
+			}
+		}
+	}
+	else
+	{
+		for (UActorComponent* Component : Owner->GetComponents())
+		{
+			if (Component && Component->GetClass()->ImplementsInterface(HandlerClass))
+			{
+				Callback(Component);
+			}
+		}
+	}
+}
+
 template <>
 bool UUxtInputSubsystem::CanHandle<UUxtFarHandler>(UObject* Handler, UPrimitiveComponent* Primitive) const
 {
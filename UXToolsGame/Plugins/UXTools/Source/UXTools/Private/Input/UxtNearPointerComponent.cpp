@@ -11,12 +11,11 @@
 #include "Engine/World.h"
 #include "HandTracking/IUxtHandTracker.h"
 #include "Input/UxtPointerFocus.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
+#include "Interactions/UxtClosestPointQuery.h"
 #include "Interactions/UxtGrabTarget.h"
 #include "Interactions/UxtPokeTarget.h"
-#include "Materials/MaterialParameterCollection.h"
-#include "Materials/MaterialParameterCollectionInstance.h"
-#include "PhysicsEngine/BodySetup.h"
-#include "UObject/ConstructorHelpers.h"
+#include "Utils/UxtParameterCollectionSubsystem.h"
 #include "VisualLogger/VisualLogger.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUxtGrabPointer, Log, All);
@@ -24,18 +23,13 @@ DEFINE_LOG_CATEGORY_STATIC(LogUxtPokePointer, Log, All);
 
 namespace
 {
-	bool IsBoxShape(UPrimitiveComponent& Primitive)
+	void LogNonBoxShape(const UPrimitiveComponent& Primitive)
 	{
-		if (UBodySetup* BodySetup = Primitive.GetBodySetup())
-		{
-			FKAggregateGeom AggGeom = BodySetup->AggGeom;
-			const int32 ElementCount = AggGeom.GetElementCount();
-			if (ElementCount != 0 && ElementCount == AggGeom.BoxElems.Num())
-			{
-				return true;
-			}
-		}
-		return false;
+		UE_LOG(
+			UXTools, Warning,
+			TEXT("Primitive %s has some collision "
+				 "shape other than box"),
+			*Primitive.GetFName().ToString());
 	}
 
 	/**
@@ -45,18 +39,15 @@ namespace
 	 *
 	 * This function assumes that the given primitive has a box collider.
 	 */
-	bool IsBehindFrontFace(UPrimitiveComponent* Primitive, FVector PointerPosition, float Radius)
+	bool IsBehindFrontFace(
+		const UPrimitiveComponent* Primitive, const FUxtPokeGeometry& Geometry, FVector PointerPosition, float Radius)
 	{
 		check(Primitive != nullptr);
 
 		// Front face pokables must have a box-shaped collider
-		if (!IsBoxShape(*Primitive))
+		if (Geometry.Shape != FUxtPokeGeometry::EShape::Box)
 		{
-			UE_LOG(
-				UXTools, Warning,
-				TEXT("Primitive %s has some collision "
-					 "shape other than box"),
-				*Primitive->GetFName().ToString());
+			LogNonBoxShape(*Primitive);
 			return false;
 		}
 
@@ -64,11 +55,9 @@ namespace
 
 		FVector LocalPosition = ComponentTransform.InverseTransformPosition(PointerPosition);
 
-		FBoxSphereBounds Bounds = Primitive->CalcLocalBounds();
-
 		float ScaledRadius = Radius / ComponentTransform.GetScaleVector().X;
 
-		if (LocalPosition.X - ScaledRadius < Bounds.BoxExtent.X)
+		if (Geometry.FrontFace.PlaneDot(LocalPosition) < ScaledRadius)
 		{
 			return true;
 		}
@@ -76,6 +65,17 @@ namespace
 		return false;
 	}
 
+	/** Get the poke geometry of the primitive from the target registry, or build it if the world has no registry. */
+	FUxtPokeGeometry GetPokeGeometry(UWorld* World, const UPrimitiveComponent* Primitive)
+	{
+		if (UUxtTargetRegistrySubsystem* TargetRegistry = World ? World->GetSubsystem<UUxtTargetRegistrySubsystem>() : nullptr)
+		{
+			return TargetRegistry->GetPokeGeometry(Primitive);
+		}
+
+		return FUxtPokeGeometry(*Primitive);
+	}
+
 	bool IsFacingPrimitive(const FVector& PointerForward, const UPrimitiveComponent* const Primitive)
 	{
 		check(Primitive);
@@ -98,18 +98,15 @@ namespace
 	 *
 	 * This function assumes that the given primitive has a box collider.
 	 */
-	bool IsFrontFacePokeEnded(UPrimitiveComponent* Primitive, FVector PointerPosition, float Radius, float Depth)
+	bool IsFrontFacePokeEnded(
+		const UPrimitiveComponent* Primitive, const FUxtPokeGeometry& Geometry, FVector PointerPosition, float Radius, float Depth)
 	{
 		check(Primitive != nullptr);
 
 		// Front face pokables must have a box-shaped collider
-		if (!IsBoxShape(*Primitive))
+		if (Geometry.Shape != FUxtPokeGeometry::EShape::Box)
 		{
-			UE_LOG(
-				UXTools, Warning,
-				TEXT("Primitive %s has some collision "
-					 "shape other than box"),
-				*Primitive->GetFName().ToString());
+			LogNonBoxShape(*Primitive);
 			return false;
 		}
 
@@ -117,9 +114,7 @@ namespace
 
 		FVector LocalPosition = ComponentTransform.InverseTransformPosition(PointerPosition);
 
-		FBoxSphereBounds Bounds = Primitive->CalcLocalBounds();
-
-		FVector Max = Bounds.BoxExtent * Primitive->GetComponentTransform().GetScale3D();
+		FVector Max = Geometry.LocalBounds.BoxExtent * Primitive->GetComponentTransform().GetScale3D();
 
 		FVector Min = -Max;
 		Min.X = Max.X - Depth; // depth is measured from the front face
@@ -155,9 +150,6 @@ UUxtNearPointerComponent::UUxtNearPointerComponent()
 	GrabFocus->VLogColor = VLogGrabFocusColor;
 	PokeFocus->VLogColor = VLogPokeFocusColor;
 #endif // ENABLE_VISUAL_LOG
-
-	static ConstructorHelpers::FObjectFinder<UMaterialParameterCollection> Finder(TEXT("/UXTools/Materials/MPC_UXSettings"));
-	ParameterCollection = Finder.Object;
 }
 
 UUxtNearPointerComponent::~UUxtNearPointerComponent()
@@ -171,11 +163,15 @@ void UUxtNearPointerComponent::BeginPlay()
 	Super::BeginPlay();
 
 	// Set initial finger tip position to an unlikely value
-	UpdateParameterCollection(FVector(FLT_MAX));
+	UpdateParameterCollection(UUxtParameterCollectionSubsystem::InactivePointerPosition);
+
+	CreateFingerPointers();
 }
 
 void UUxtNearPointerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	DestroyFingerPointers();
+
 	if (GrabFocus->IsGrabbing())
 	{
 		GrabFocus->EndGrab(this);
@@ -187,57 +183,224 @@ void UUxtNearPointerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
-static FTransform CalcGrabPointerTransform(EControllerHand Hand)
+void UUxtNearPointerComponent::UpdateParameterCollection(FVector IndexTipPosition)
 {
-	FQuat IndexTipOrientation, ThumbTipOrientation;
-	FVector IndexTipPosition, ThumbTipPosition;
-	float IndexTipRadius, ThumbTipRadius;
-	if (IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius) &&
-		IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::ThumbTip, ThumbTipOrientation, ThumbTipPosition, ThumbTipRadius))
+	// Only the primary pointer of a hand drives the pointer position
+	if (IsFingerPointer())
 	{
-		// Use the midway point between the thumb and index finger tips for grab
-		const float LerpFactor = 0.5f;
-		return FTransform(
-			FMath::Lerp(IndexTipOrientation, ThumbTipOrientation, LerpFactor), FMath::Lerp(IndexTipPosition, ThumbTipPosition, LerpFactor));
+		return;
+	}
+
+	if (UUxtParameterCollectionSubsystem* ParameterCollection = GetWorld()->GetSubsystem<UUxtParameterCollectionSubsystem>())
+	{
+		ParameterCollection->SetPointerPosition(Hand, IndexTipPosition);
 	}
-	return FTransform::Identity;
 }
 
-static FTransform CalcPokePointerTransform(EControllerHand Hand)
+void UUxtNearPointerComponent::QueryProximityPrimitives(const FVector& ProximityCenter, float QueryRadius)
 {
-	FQuat IndexTipOrientation;
-	FVector IndexTipPosition;
-	float IndexTipRadius;
-	if (IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius))
+	// The target registry is queried on the game thread anyway, asynchronous queries only apply to scene overlaps
+	const bool bUseAsyncQuery = bUseAsyncProximityQuery && !bUseTargetRegistry;
+	const bool bCanReuseQuery = bReuseProximityQuery || bUseAsyncQuery;
+
+	// Finger pointers need the candidates of the query even if they are not reused in the next frame
+	if (!bCanReuseQuery && FingerPointers.Num() == 0)
 	{
-		return FTransform(IndexTipOrientation, IndexTipPosition);
+		ProximityCandidates.Reset();
+		QueryScene(ProximityCenter, ProximityRadius);
+		return;
+	}
+
+	if (bUseAsyncQuery)
+	{
+		ConsumeAsyncProximityQuery();
+	}
+
+	// Query synchronously if the pointer has moved out of the volume covered by the candidates
+	if (!bCanReuseQuery || !CanReuseProximityCandidates(ProximityCenter, QueryRadius))
+	{
+		// Expand the query by the margin so that the candidates stay valid while the pointer moves less than the margin
+		ProximityCandidatesCenter = ProximityCenter;
+		ProximityCandidatesRadius = QueryRadius + (bCanReuseQuery ? FMath::Max(ProximityQueryMargin, 0.0f) : 0.0f);
+		ProximityCandidatesTime = GetWorld()->GetTimeSeconds();
+		ProximityCandidatesChannel = TraceChannel;
+		bProximityCandidatesFromRegistry = bUseTargetRegistry;
+
+		QueryScene(ProximityCandidatesCenter, ProximityCandidatesRadius);
+
+		ProximityCandidates.Reset(ProximityPrimitives.Num());
+		for (UPrimitiveComponent* Primitive : ProximityPrimitives)
+		{
+			ProximityCandidates.Add(Primitive);
+		}
+	}
+
+	FilterProximityCandidates(ProximityCandidates, ProximityCenter);
+
+	if (bUseAsyncQuery)
+	{
+		RequestAsyncProximityQuery(ProximityCenter, QueryRadius);
+	}
+	else
+	{
+		AsyncProximityQuery = FTraceHandle();
 	}
-	return FTransform(FQuat::Identity, FVector(FLT_MAX));
 }
 
-void UUxtNearPointerComponent::UpdateParameterCollection(FVector IndexTipPosition)
+void UUxtNearPointerComponent::RequestAsyncProximityQuery(const FVector& ProximityCenter, float QueryRadius)
+{
+	AsyncProximityQueryRadius = QueryRadius + FMath::Max(ProximityQueryMargin, 0.0f);
+	AsyncProximityQueryTime = GetWorld()->GetTimeSeconds();
+	AsyncProximityQueryChannel = TraceChannel;
+
+	// Disable complex collision to enable overlap from inside primitives
+	FCollisionQueryParams QueryParams(NAME_None, false);
+
+	AsyncProximityQuery = GetWorld()->AsyncOverlapByChannel(
+		ProximityCenter, FQuat::Identity, TraceChannel, FCollisionShape::MakeSphere(AsyncProximityQueryRadius), QueryParams);
+}
+
+void UUxtNearPointerComponent::ConsumeAsyncProximityQuery()
+{
+	if (!AsyncProximityQuery.IsValid())
+	{
+		return;
+	}
+
+	// Results of queries requested in the previous frame are available now, older results have been discarded
+	FOverlapDatum Datum;
+	const bool bHasResults = GetWorld()->QueryOverlapData(AsyncProximityQuery, Datum);
+	AsyncProximityQuery = FTraceHandle();
+
+	if (bHasResults)
+	{
+		ProximityCandidatesCenter = Datum.Pos;
+		ProximityCandidatesRadius = AsyncProximityQueryRadius;
+		ProximityCandidatesTime = AsyncProximityQueryTime;
+		ProximityCandidatesChannel = AsyncProximityQueryChannel;
+		bProximityCandidatesFromRegistry = false;
+
+		ProximityCandidates.Reset(Datum.OutOverlaps.Num());
+		for (const FOverlapResult& Overlap : Datum.OutOverlaps)
+		{
+			if (UPrimitiveComponent* Primitive = Overlap.GetComponent())
+			{
+				ProximityCandidates.Add(Primitive);
+			}
+		}
+	}
+}
+
+void UUxtNearPointerComponent::QueryScene(const FVector& Center, float Radius)
 {
-	if (ParameterCollection)
+	ProximityPrimitives.Reset();
+
+	if (bUseTargetRegistry)
 	{
-		UMaterialParameterCollectionInstance* ParameterCollectionInstance = GetWorld()->GetParameterCollectionInstance(ParameterCollection);
-		static FName ParameterNames[] = {"LeftPointerPosition", "RightPointerPosition"};
-		FName ParameterName = Hand == EControllerHand::Left ? ParameterNames[0] : ParameterNames[1];
-		const bool bFoundParameter = ParameterCollectionInstance->SetVectorParameterValue(ParameterName, IndexTipPosition);
+		if (UUxtTargetRegistrySubsystem* TargetRegistry = GetWorld()->GetSubsystem<UUxtTargetRegistrySubsystem>())
+		{
+			TargetRegistry->QueryProximity(Center, Radius, TraceChannel, ProximityPrimitives);
+			return;
+		}
+	}
+
+	// Disable complex collision to enable overlap from inside primitives
+	FCollisionQueryParams QueryParams(NAME_None, false);
+
+	ProximityOverlaps.Reset();
+	/*bool HasBlockingOverlap = */ GetWorld()->OverlapMultiByChannel(
+		ProximityOverlaps, Center, FQuat::Identity, TraceChannel, FCollisionShape::MakeSphere(Radius), QueryParams);
 
-		if (!bFoundParameter)
+	for (const FOverlapResult& Overlap : ProximityOverlaps)
+	{
+		if (UPrimitiveComponent* Primitive = Overlap.GetComponent())
 		{
-			UE_LOG(
-				UXTools, Warning, TEXT("Unable to find %s parameter in material parameter collection %s."), *ParameterName.ToString(),
-				*ParameterCollection->GetPathName());
+			ProximityPrimitives.Add(Primitive);
+		}
+	}
+}
+
+bool UUxtNearPointerComponent::CanReuseProximityCandidates(const FVector& ProximityCenter, float QueryRadius) const
+{
+	if (ProximityCandidatesRadius < 0.0f || ProximityCandidatesChannel != TraceChannel ||
+		bProximityCandidatesFromRegistry != bUseTargetRegistry)
+	{
+		return false;
+	}
+
+	if (GetWorld()->GetTimeSeconds() - ProximityCandidatesTime > MaxProximityQueryInterval)
+	{
+		return false;
+	}
+
+	// The current query sphere must be contained in the sphere of the expanded query
+	const float MaxDistance = ProximityCandidatesRadius - QueryRadius;
+	return MaxDistance >= 0.0f && FVector::DistSquared(ProximityCenter, ProximityCandidatesCenter) <= FMath::Square(MaxDistance);
+}
+
+void UUxtNearPointerComponent::FilterProximityCandidates(
+	const TArray<TWeakObjectPtr<UPrimitiveComponent>>& Candidates, const FVector& ProximityCenter)
+{
+	ProximityPrimitives.Reset();
+
+	TArray<UPrimitiveComponent*, TInlineAllocator<16>> Primitives;
+	for (const TWeakObjectPtr<UPrimitiveComponent>& Candidate : Candidates)
+	{
+		if (UPrimitiveComponent* Primitive = Candidate.Get())
+		{
+			Primitives.Add(Primitive);
+		}
+	}
+
+	TArray<FVector, TInlineAllocator<16>> PointsOnSurface;
+	TArray<float, TInlineAllocator<16>> DistancesSqr;
+	PointsOnSurface.SetNumUninitialized(Primitives.Num());
+	DistancesSqr.SetNumUninitialized(Primitives.Num());
+	FUxtClosestPointQuery::GetClosestPoints(
+		TArrayView<const UPrimitiveComponent* const>(Primitives.GetData(), Primitives.Num()), ProximityCenter, PointsOnSurface,
+		DistancesSqr);
+
+	// Keep primitives that would overlap the proximity sphere, in the order of the original query
+	const float RadiusSqr = FMath::Square(ProximityRadius);
+	for (int32 Index = 0; Index < Primitives.Num(); ++Index)
+	{
+		if (DistancesSqr[Index] >= 0.0f && DistancesSqr[Index] <= RadiusSqr)
+		{
+			ProximityPrimitives.Add(Primitives[Index]);
 		}
 	}
 }
 
 void UUxtNearPointerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
-	// Update cached transforms
-	GrabPointerTransform = CalcGrabPointerTransform(Hand);
-	PokePointerTransform = CalcPokePointerTransform(Hand);
+	if (IsFingerPointer())
+	{
+		TickFingerPointer();
+		return;
+	}
+
+	// Update cached transforms from the snapshot of the hand in this frame
+	const FUxtHandFrame& HandFrame = IUxtHandTracker::Get().GetHandFrame(Hand);
+	float QueryRadius = ProximityRadius;
+	if (HandFrame.HasJoints())
+	{
+		GrabPointerTransform = HandFrame.GetGrabPointerTransform();
+		PokePointerTransform = HandFrame.GetJointTransform(PokeJoint);
+		PokePointerRadius = HandFrame.GetJointRadius(PokeJoint);
+
+		// Expand the shared query to cover the proximity volumes of all finger pointers
+		for (const UUxtNearPointerComponent* FingerPointer : FingerPointers)
+		{
+			const FVector& FingerPosition = HandFrame.GetJointPosition(FingerPointer->PokeJoint);
+			QueryRadius = FMath::Max(QueryRadius, ProximityRadius + FVector::Dist(FingerPosition, GrabPointerTransform.GetLocation()));
+		}
+	}
+	else
+	{
+		GrabPointerTransform = FTransform::Identity;
+		PokePointerTransform = FTransform(FQuat::Identity, FVector(FLT_MAX));
+		PokePointerRadius = 0;
+	}
 	UpdateParameterCollection(PokePointerTransform.GetLocation());
 
 	// Unlock focus if targets have been removed,
@@ -250,6 +413,12 @@ void UUxtNearPointerComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 		}
 	}
 
+	// Finger pointers rely on the proximity query even while this pointer's focus is locked
+	if (!bFocusLocked || FingerPointers.Num() > 0)
+	{
+		QueryProximityPrimitives(GrabPointerTransform.GetLocation(), QueryRadius);
+	}
+
 	// Don't change the focused target if focus is locked
 	if (bFocusLocked)
 	{
@@ -258,17 +427,9 @@ void UUxtNearPointerComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 	}
 	else
 	{
-		const FVector ProximityCenter = GrabPointerTransform.GetLocation();
-
-		// Disable complex collision to enable overlap from inside primitives
-		FCollisionQueryParams QueryParams(NAME_None, false);
-
-		TArray<FOverlapResult> Overlaps;
-		/*bool HasBlockingOverlap = */ GetWorld()->OverlapMultiByChannel(
-			Overlaps, ProximityCenter, FQuat::Identity, TraceChannel, FCollisionShape::MakeSphere(ProximityRadius), QueryParams);
-
-		GrabFocus->SelectClosestTarget(this, GrabPointerTransform, Overlaps);
-		PokeFocus->SelectClosestTarget(this, PokePointerTransform, Overlaps);
+		// Grab and poke share the proximity results, evaluate both in a single pass
+		FUxtPointerFocus::SelectClosestTargets(
+			this, *GrabFocus, GrabPointerTransform, *PokeFocus, PokePointerTransform, ProximityPrimitives);
 	}
 
 	// Update poking state based on poke target
@@ -310,11 +471,133 @@ void UUxtNearPointerComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 #endif // ENABLE_VISUAL_LOG
 }
 
+void UUxtNearPointerComponent::TickFingerPointer()
+{
+	const UUxtNearPointerComponent* Primary = PrimaryPointerWeak.Get();
+	if (!Primary)
+	{
+		return;
+	}
+
+	// Follow the settings of the primary pointer, which may change at runtime
+	Hand = Primary->Hand;
+	TraceChannel = Primary->TraceChannel;
+	ProximityRadius = Primary->ProximityRadius;
+	PokeDepth = Primary->PokeDepth;
+	DebounceDepth = Primary->DebounceDepth;
+	FocusSwitchMargin = Primary->FocusSwitchMargin;
+	FocusSwitchDwellTime = Primary->FocusSwitchDwellTime;
+
+	const FUxtHandFrame& HandFrame = IUxtHandTracker::Get().GetHandFrame(Hand);
+	if (HandFrame.HasJoints())
+	{
+		PokePointerTransform = HandFrame.GetJointTransform(PokeJoint);
+		PokePointerRadius = HandFrame.GetJointRadius(PokeJoint);
+	}
+	else
+	{
+		PokePointerTransform = FTransform(FQuat::Identity, FVector(FLT_MAX));
+		PokePointerRadius = 0;
+	}
+
+	// Finger pointers don't grab, keep the grab transform at the finger tip
+	GrabPointerTransform = PokePointerTransform;
+
+	if (bFocusLocked && !PokeFocus->GetFocusedTarget())
+	{
+		bFocusLocked = false;
+	}
+
+	if (bFocusLocked)
+	{
+		PokeFocus->UpdateClosestTarget(PokePointerTransform);
+	}
+	else
+	{
+		// The primary pointer's query covers the proximity volume of the finger tip
+		FilterProximityCandidates(Primary->ProximityCandidates, PokePointerTransform.GetLocation());
+		PokeFocus->SelectClosestTarget(this, PokePointerTransform, ProximityPrimitives);
+	}
+
+	UpdatePokeInteraction();
+
+	PokeFocus->UpdateFocus(this);
+
+#if ENABLE_VISUAL_LOG
+	VLogPointer(VLogCategoryPokePointer, VLogPokeFocusColor, "Finger Pointer", PokePointerTransform.GetLocation(), PokeRadius, PokeFocus);
+#endif // ENABLE_VISUAL_LOG
+}
+
+void UUxtNearPointerComponent::CreateFingerPointers()
+{
+	if (IsFingerPointer())
+	{
+		return;
+	}
+
+	for (EHandKeypoint Joint : AdditionalPokeJoints)
+	{
+		UUxtNearPointerComponent* FingerPointer = NewObject<UUxtNearPointerComponent>(GetOwner());
+		FingerPointer->PrimaryPointerWeak = this;
+		FingerPointer->PokeJoint = Joint;
+		FingerPointer->Hand = Hand;
+		FingerPointer->TraceChannel = TraceChannel;
+		FingerPointer->ProximityRadius = ProximityRadius;
+		FingerPointer->PokeRadius = PokeRadius;
+		FingerPointer->PokeDepth = PokeDepth;
+		FingerPointer->DebounceDepth = DebounceDepth;
+
+		// Finger pointers use the proximity candidates of this pointer, so they must tick after it
+		FingerPointer->PrimaryComponentTick.TickGroup = PrimaryComponentTick.TickGroup;
+		FingerPointer->AddTickPrerequisiteComponent(this);
+		FingerPointer->bAutoActivate = IsActive();
+		FingerPointer->RegisterComponent();
+
+		FingerPointers.Add(FingerPointer);
+	}
+}
+
+void UUxtNearPointerComponent::DestroyFingerPointers()
+{
+	for (UUxtNearPointerComponent* FingerPointer : FingerPointers)
+	{
+		if (IsValid(FingerPointer))
+		{
+			FingerPointer->DestroyComponent();
+		}
+	}
+
+	FingerPointers.Empty();
+}
+
+bool UUxtNearPointerComponent::IsFingerPointer() const
+{
+	return !PrimaryPointerWeak.IsExplicitlyNull();
+}
+
+TArray<UUxtNearPointerComponent*> UUxtNearPointerComponent::GetFingerPointers() const
+{
+	return FingerPointers;
+}
+
+UUxtNearPointerComponent* UUxtNearPointerComponent::GetPrimaryPointer() const
+{
+	return PrimaryPointerWeak.Get();
+}
+
 void UUxtNearPointerComponent::SetActive(bool bNewActive, bool bReset)
 {
 	bool bOldActive = IsActive();
 	Super::SetActive(bNewActive, bReset);
 
+	for (UUxtNearPointerComponent* FingerPointer : FingerPointers)
+	{
+		if (IsValid(FingerPointer))
+		{
+			FingerPointer->SetActive(bNewActive, bReset);
+		}
+	}
+
 	if (!IUxtHandTracker::Get().GetIsGrabbing(Hand, bHandWasGrabbing))
 	{
 		bHandWasGrabbing = false;
@@ -337,7 +620,7 @@ void UUxtNearPointerComponent::SetActive(bool bNewActive, bool bReset)
 		bFocusLocked = false;
 
 		// Set finger tip position to an unlikely value
-		UpdateParameterCollection(FVector(FLT_MAX));
+		UpdateParameterCollection(UUxtParameterCollectionSubsystem::InactivePointerPosition);
 	}
 }
 
@@ -368,6 +651,9 @@ void UUxtNearPointerComponent::UpdatePokeInteraction()
 	UActorComponent* Target = Cast<UActorComponent>(PokeFocus->GetFocusedTarget());
 	UPrimitiveComponent* Primitive = PokeFocus->GetFocusedPrimitive();
 
+	// Collision geometry of the focused primitive, cached across frames. Copied, poke events may change the primitive.
+	const FUxtPokeGeometry Geometry = Primitive ? GetPokeGeometry(GetWorld(), Primitive) : FUxtPokeGeometry();
+
 	if (PokeFocus->IsPoking())
 	{
 		if (Primitive && Target)
@@ -377,7 +663,8 @@ void UUxtNearPointerComponent::UpdatePokeInteraction()
 			switch (IUxtPokeTarget::Execute_GetPokeBehaviour(Target))
 			{
 			case EUxtPokeBehaviour::FrontFace:
-				endedPoking = IsFrontFacePokeEnded(Primitive, PokePointerLocation, GetPokePointerRadius() + DebounceDepth, PokeDepth);
+				endedPoking = IsFrontFacePokeEnded(
+					Primitive, Geometry, PokePointerLocation, GetPokePointerRadius() + DebounceDepth, PokeDepth);
 				break;
 			case EUxtPokeBehaviour::Volume:
 				endedPoking = !Primitive->OverlapComponent(
@@ -389,7 +676,7 @@ void UUxtNearPointerComponent::UpdatePokeInteraction()
 			{
 				PokeFocus->EndPoke(this);
 
-				bWasBehindFrontFace = IsBehindFrontFace(Primitive, PokePointerLocation, GetPokePointerRadius());
+				bWasBehindFrontFace = IsBehindFrontFace(Primitive, Geometry, PokePointerLocation, GetPokePointerRadius());
 			}
 			else
 			{
@@ -412,7 +699,7 @@ void UUxtNearPointerComponent::UpdatePokeInteraction()
 		bool isBehind = bWasBehindFrontFace;
 		if (Primitive)
 		{
-			isBehind = IsBehindFrontFace(Primitive, End, GetPokePointerRadius());
+			isBehind = IsBehindFrontFace(Primitive, Geometry, End, GetPokePointerRadius());
 		}
 
 		FHitResult HitResult;
@@ -524,14 +811,7 @@ FTransform UUxtNearPointerComponent::GetPokePointerTransform() const
 
 float UUxtNearPointerComponent::GetPokePointerRadius() const
 {
-	FQuat IndexTipOrientation;
-	FVector IndexTipPosition;
-	float IndexTipRadius;
-	if (IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius))
-	{
-		return IndexTipRadius;
-	}
-	return 0;
+	return PokePointerRadius;
 }
 
 #if ENABLE_VISUAL_LOG
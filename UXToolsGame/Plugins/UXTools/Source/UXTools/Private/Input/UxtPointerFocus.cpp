@@ -4,8 +4,10 @@
 #include "Input/UxtPointerFocus.h"
 
 #include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
 #include "Input/UxtInputSubsystem.h"
 #include "Input/UxtNearPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Interactions/UxtGrabHandler.h"
 #include "Interactions/UxtGrabTarget.h"
 #include "Interactions/UxtInteractionUtils.h"
@@ -51,10 +53,41 @@ UObject* FUxtPointerFocus::GetFocusedTargetChecked() const
 }
 
 void FUxtPointerFocus::SelectClosestTarget(
-	UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const TArray<FOverlapResult>& Overlaps)
+	UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const TArray<UPrimitiveComponent*>& Primitives)
 {
-	FUxtPointerFocusSearchResult Result = FindClosestTarget(Overlaps, PointerTransform.GetLocation());
-	SetFocus(Pointer, PointerTransform, Result);
+	UWorld* World = Pointer->GetWorld();
+	UUxtTargetRegistrySubsystem* Registry = World ? World->GetSubsystem<UUxtTargetRegistrySubsystem>() : nullptr;
+
+	FUxtPointerFocusSearchResult Result = FindClosestTarget(Registry, Primitives, PointerTransform.GetLocation());
+	SetClosestFocus(Pointer, PointerTransform, Primitives, Result);
+}
+
+void FUxtPointerFocus::SelectClosestTargets(
+	UUxtNearPointerComponent* Pointer, FUxtPointerFocus& FocusA, const FTransform& PointerTransformA, FUxtPointerFocus& FocusB,
+	const FTransform& PointerTransformB, const TArray<UPrimitiveComponent*>& Primitives)
+{
+	UWorld* World = Pointer->GetWorld();
+	UUxtTargetRegistrySubsystem* Registry = World ? World->GetSubsystem<UUxtTargetRegistrySubsystem>() : nullptr;
+
+	const FVector PointA = PointerTransformA.GetLocation();
+	const FVector PointB = PointerTransformB.GetLocation();
+	FUxtPointerFocusSearchResult ResultA = {nullptr, nullptr, FVector::ZeroVector, FVector::ForwardVector, MAX_FLT};
+	FUxtPointerFocusSearchResult ResultB = {nullptr, nullptr, FVector::ZeroVector, FVector::ForwardVector, MAX_FLT};
+
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		if (Primitive && Primitive->GetOwner())
+		{
+			FocusA.TestClosestPrimitive(Registry, Primitive, PointA, ResultA);
+			FocusB.TestClosestPrimitive(Registry, Primitive, PointB, ResultB);
+		}
+	}
+
+	FocusA.CompleteSearch(ResultA);
+	FocusB.CompleteSearch(ResultB);
+
+	FocusA.SetClosestFocus(Pointer, PointerTransformA, Primitives, ResultA);
+	FocusB.SetClosestFocus(Pointer, PointerTransformB, Primitives, ResultB);
 }
 
 void FUxtPointerFocus::UpdateClosestTarget(const FTransform& PointerTransform)
@@ -155,6 +188,59 @@ void FUxtPointerFocus::SetFocus(
 	}
 }
 
+void FUxtPointerFocus::SetClosestFocus(
+	UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const TArray<UPrimitiveComponent*>& Primitives,
+	const FUxtPointerFocusSearchResult& FocusResult)
+{
+	UActorComponent* FocusedTarget = Cast<UActorComponent>(FocusedTargetWeak.Get());
+	UPrimitiveComponent* FocusedPrimitive = FocusedPrimitiveWeak.Get();
+
+	// Hysteresis only applies when switching between targets, while the focused primitive is still in proximity
+	const bool bIsSwitch = FocusResult.IsValid() && FocusedTarget && FocusedPrimitive &&
+						   (FocusResult.Target != FocusedTarget || FocusResult.Primitive != FocusedPrimitive);
+	const bool bHasHysteresis = Pointer->FocusSwitchMargin > 0.0f || Pointer->FocusSwitchDwellTime > 0.0f;
+
+	if (bIsSwitch && bHasHysteresis && Primitives.Contains(FocusedPrimitive))
+	{
+		const FVector Point = PointerTransform.GetLocation();
+		FVector PointOnTarget;
+		FVector Normal;
+		if (GetClosestPointOnTarget(FocusedTarget, FocusedPrimitive, Point, PointOnTarget, Normal))
+		{
+			const float FocusedDistance = FVector::Dist(Point, PointOnTarget);
+			bool bKeepFocus = FocusedDistance <= FocusResult.MinDistance + Pointer->FocusSwitchMargin;
+
+			if (bKeepFocus)
+			{
+				PendingTargetWeak = nullptr;
+				PendingPrimitiveWeak = nullptr;
+			}
+			else if (Pointer->FocusSwitchDwellTime > 0.0f)
+			{
+				// Switch once the new target has been closest for the dwell time
+				const float Time = Pointer->GetWorld()->GetTimeSeconds();
+				if (PendingTargetWeak.Get() != FocusResult.Target || PendingPrimitiveWeak.Get() != FocusResult.Primitive)
+				{
+					PendingTargetWeak = FocusResult.Target;
+					PendingPrimitiveWeak = FocusResult.Primitive;
+					PendingTime = Time;
+				}
+				bKeepFocus = Time - PendingTime < Pointer->FocusSwitchDwellTime;
+			}
+
+			if (bKeepFocus)
+			{
+				SetFocus(Pointer, PointerTransform, {FocusedTarget, FocusedPrimitive, PointOnTarget, Normal, FocusedDistance});
+				return;
+			}
+		}
+	}
+
+	PendingTargetWeak = nullptr;
+	PendingPrimitiveWeak = nullptr;
+	SetFocus(Pointer, PointerTransform, FocusResult);
+}
+
 /** Find a component of the actor that implements the given interface type. */
 UActorComponent* FUxtPointerFocus::FindInterfaceComponent(AActor* Owner) const
 {
@@ -168,78 +254,118 @@ UActorComponent* FUxtPointerFocus::FindInterfaceComponent(AActor* Owner) const
 	return nullptr;
 }
 
-FUxtPointerFocusSearchResult FUxtPointerFocus::FindClosestTarget(const TArray<FOverlapResult>& Overlaps, const FVector& Point) const
+FUxtPointerFocusSearchResult FUxtPointerFocus::FindClosestTarget(
+	UUxtTargetRegistrySubsystem* Registry, const TArray<UPrimitiveComponent*>& Primitives, const FVector& Point) const
 {
-	float MinDistanceSqr = MAX_FLT;
-	UActorComponent* ClosestTarget = nullptr;
-	UPrimitiveComponent* ClosestPrimitive = nullptr;
-	FVector ClosestPointOnTarget = FVector::ZeroVector;
-	FVector ClosestNormal = FVector::ForwardVector;
+	FUxtPointerFocusSearchResult Result = {nullptr, nullptr, FVector::ZeroVector, FVector::ForwardVector, MAX_FLT};
 
-	for (const FOverlapResult& Overlap : Overlaps)
+	for (UPrimitiveComponent* Primitive : Primitives)
 	{
-		AActor* Actor = Overlap.GetActor();
-		UPrimitiveComponent* Primitive = Overlap.GetComponent();
+		if (Primitive && Primitive->GetOwner())
+		{
+			TestClosestPrimitive(Registry, Primitive, Point, Result);
+		}
+	}
+
+	CompleteSearch(Result);
+	return Result;
+}
+
+void FUxtPointerFocus::TestClosestPrimitive(
+	UUxtTargetRegistrySubsystem* Registry, UPrimitiveComponent* Primitive, const FVector& Point,
+	FUxtPointerFocusSearchResult& InOutResult) const
+{
+	const bool bIsClosestPointOnPrimitive = IsClosestPointOnPrimitive();
+
+	// The closest point on the collision can't be closer than the bounds
+	if (bIsClosestPointOnPrimitive && Primitive->Bounds.GetBox().ComputeSquaredDistanceToPoint(Point) >= InOutResult.MinDistance)
+	{
+		return;
+	}
 
-		if (Actor && Primitive)
+	AActor* Actor = Primitive->GetOwner();
+	if (Registry)
+	{
+		for (const TWeakObjectPtr<UActorComponent>& ComponentWeak : Registry->GetCachedComponents(Actor, GetInterfaceClass()))
 		{
-			for (UActorComponent* Component : Actor->GetComponents())
+			UActorComponent* Component = ComponentWeak.Get();
+			if (Component)
 			{
-				if (ImplementsTargetInterface(Component))
+				// We keep the first target component that takes ownership of the primitive.
+				// If the closest point doesn't depend on the target, other targets won't give a different result.
+				if (TestClosestTargetCandidate(Component, Primitive, Point, InOutResult) || bIsClosestPointOnPrimitive)
 				{
-					FVector PointOnTarget;
-					FVector Normal;
-
-					if (GetClosestPointOnTarget(Component, Primitive, Point, PointOnTarget, Normal))
-					{
-						float DistanceSqr = (Point - PointOnTarget).SizeSquared();
-						if (DistanceSqr < MinDistanceSqr)
-						{
-							MinDistanceSqr = DistanceSqr;
-							ClosestTarget = Component;
-							ClosestPrimitive = Primitive;
-							ClosestPointOnTarget = PointOnTarget;
-							ClosestNormal = Normal;
-						}
-
-#if ENABLE_VISUAL_LOG
-						VLogFocus(Overlap.GetComponent(), PointOnTarget, Normal, false);
-#endif // ENABLE_VISUAL_LOG
-
-						// We keep the first target component that takes ownership of the primitive.
-						break;
-					}
+					break;
+				}
+			}
+		}
+	}
+	else
+	{
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (ImplementsTargetInterface(Component))
+			{
+				if (TestClosestTargetCandidate(Component, Primitive, Point, InOutResult) || bIsClosestPointOnPrimitive)
+				{
+					break;
 				}
 			}
 		}
 	}
+}
 
-	if (ClosestTarget != nullptr)
+void FUxtPointerFocus::CompleteSearch(FUxtPointerFocusSearchResult& InOutResult) const
+{
+	if (InOutResult.Target != nullptr)
 	{
 #if ENABLE_VISUAL_LOG
-		VLogFocus(ClosestPrimitive, ClosestPointOnTarget, ClosestNormal, true);
+		VLogFocus(InOutResult.Primitive, InOutResult.ClosestPointOnTarget, InOutResult.Normal, true);
 #endif // ENABLE_VISUAL_LOG
 
-		return {ClosestTarget, ClosestPrimitive, ClosestPointOnTarget, ClosestNormal, FMath::Sqrt(MinDistanceSqr)};
+		InOutResult.MinDistance = FMath::Sqrt(InOutResult.MinDistance);
 	}
-	else
+}
+
+bool FUxtPointerFocus::TestClosestTargetCandidate(
+	UActorComponent* Component, UPrimitiveComponent* Primitive, const FVector& Point, FUxtPointerFocusSearchResult& InOutResult) const
+{
+	FVector PointOnTarget;
+	FVector Normal;
+
+	if (!GetClosestPointOnTarget(Component, Primitive, Point, PointOnTarget, Normal))
+	{
+		return false;
+	}
+
+	// Distance is kept squared until the search is complete
+	float DistanceSqr = (Point - PointOnTarget).SizeSquared();
+	if (DistanceSqr < InOutResult.MinDistance)
 	{
-		return {nullptr, nullptr, FVector::ZeroVector, FVector::ForwardVector, MAX_FLT};
+		InOutResult = {Component, Primitive, PointOnTarget, Normal, DistanceSqr};
 	}
+
+#if ENABLE_VISUAL_LOG
+	VLogFocus(Primitive, PointOnTarget, Normal, false);
+#endif // ENABLE_VISUAL_LOG
+
+	return true;
 }
 
 FUxtPointerFocusSearchResult FUxtPointerFocus::FindClosestPointOnComponent(UActorComponent* Target, const FVector& Point) const
 {
-	if (Target->GetOwner())
+	if (AActor* Owner = Target->GetOwner())
 	{
-		TArray<UPrimitiveComponent*> PrimitiveComponents;
-		Target->GetOwner()->GetComponents<UPrimitiveComponent>(PrimitiveComponents);
+		UWorld* World = Owner->GetWorld();
+		UUxtTargetRegistrySubsystem* Registry = World ? World->GetSubsystem<UUxtTargetRegistrySubsystem>() : nullptr;
 
 		UPrimitiveComponent* ClosestPrimitive = nullptr;
 		FVector ClosestPoint = FVector::ZeroVector;
 		FVector ClosestNormal = FVector::ForwardVector;
 		float MinDistanceSqr = -1.f;
-		for (UPrimitiveComponent* Primitive : PrimitiveComponents)
+
+		// Returns true when no closer point can be found
+		auto TestPrimitive = [&](UPrimitiveComponent* Primitive)
 		{
 			FVector PointOnPrimitive;
 			FVector Normal;
@@ -253,9 +379,33 @@ FUxtPointerFocusSearchResult FUxtPointerFocus::FindClosestPointOnComponent(UActo
 				ClosestPoint = PointOnPrimitive;
 				ClosestNormal = Normal;
 
-				if (MinDistanceSqr <= KINDA_SMALL_NUMBER)
+				// Best result to be expected.
+				return MinDistanceSqr <= KINDA_SMALL_NUMBER;
+			}
+			return false;
+		};
+
+		if (Registry)
+		{
+			for (const TWeakObjectPtr<UActorComponent>& ComponentWeak :
+				 Registry->GetCachedComponents(Owner, UPrimitiveComponent::StaticClass()))
+			{
+				UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(ComponentWeak.Get());
+				if (Primitive && TestPrimitive(Primitive))
+				{
+					break;
+				}
+			}
+		}
+		else
+		{
+			TArray<UPrimitiveComponent*> PrimitiveComponents;
+			Owner->GetComponents<UPrimitiveComponent>(PrimitiveComponents);
+
+			for (UPrimitiveComponent* Primitive : PrimitiveComponents)
+			{
+				if (TestPrimitive(Primitive))
 				{
-					// Best result to be expected.
 					break;
 				}
 			}
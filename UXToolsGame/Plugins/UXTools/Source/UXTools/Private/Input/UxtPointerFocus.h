@@ -9,6 +9,7 @@
 #include "Engine/EngineTypes.h"
 
 class UUxtNearPointerComponent;
+class UUxtTargetRegistrySubsystem;
 class UActorComponent;
 class UPrimitiveComponent;
 
@@ -58,8 +59,17 @@ public:
 
 	// TODO get hand joints from WMR => no need to pass PointerTransform
 
-	/** Select and set the focused target among the list of overlaps. */
-	void SelectClosestTarget(UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const TArray<FOverlapResult>& Overlaps);
+	/** Select and set the focused target among the list of primitives overlapping the pointer proximity volume. */
+	void SelectClosestTarget(
+		UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const TArray<UPrimitiveComponent*>& Primitives);
+
+	/**
+	 * Select and set the focused targets of two pointers, e.g. grab and poke, visiting the list of primitives only once.
+	 * Gives the same result as calling SelectClosestTarget on each focus.
+	 */
+	static void SelectClosestTargets(
+		UUxtNearPointerComponent* Pointer, FUxtPointerFocus& FocusA, const FTransform& PointerTransformA, FUxtPointerFocus& FocusB,
+		const FTransform& PointerTransformB, const TArray<UPrimitiveComponent*>& Primitives);
 
 	/** Update the ClosestTargetPoint while focus is locked */
 	void UpdateClosestTarget(const FTransform& PointerTransform);
@@ -89,18 +99,49 @@ protected:
 	/** Set the focus to the given target object, primitive, and point on the target. */
 	void SetFocus(UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const FUxtPointerFocusSearchResult& FocusResult);
 
-	/** Find the closest target object, primitive, and point among the overlaps. */
-	FUxtPointerFocusSearchResult FindClosestTarget(const TArray<FOverlapResult>& Overlaps, const FVector& Point) const;
+	/**
+	 * Set the focus to the closest target found among the primitives, unless the focus switch margin or dwell time of the pointer
+	 * keep the currently focused target.
+	 */
+	void SetClosestFocus(
+		UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const TArray<UPrimitiveComponent*>& Primitives,
+		const FUxtPointerFocusSearchResult& FocusResult);
+
+	/**
+	 * Find the closest target object, primitive, and point among the given primitives.
+	 * Target components are looked up in the registry cache if available.
+	 */
+	FUxtPointerFocusSearchResult FindClosestTarget(
+		UUxtTargetRegistrySubsystem* Registry, const TArray<UPrimitiveComponent*>& Primitives, const FVector& Point) const;
+
+	/** Test the targets of a single primitive and update the closest result if one of them is closer. */
+	void TestClosestPrimitive(
+		UUxtTargetRegistrySubsystem* Registry, UPrimitiveComponent* Primitive, const FVector& Point,
+		FUxtPointerFocusSearchResult& InOutResult) const;
+
+	/** Finish a search over primitives, converting the squared distance of the closest result. */
+	void CompleteSearch(FUxtPointerFocusSearchResult& InOutResult) const;
 
 	/** Find the closest primitive and point on the owner of the given component. */
 	FUxtPointerFocusSearchResult FindClosestPointOnComponent(UActorComponent* Target, const FVector& Point) const;
 
+	/** Test the primitive against a candidate target component and update the closest result if it takes ownership of the primitive. */
+	bool TestClosestTargetCandidate(
+		UActorComponent* Component, UPrimitiveComponent* Primitive, const FVector& Point, FUxtPointerFocusSearchResult& InOutResult) const;
+
 	/** Get the interface class that targets for the pointer must implement. */
 	virtual UClass* GetInterfaceClass() const = 0;
 
 	/** Returns true if the given object implements the required target interface. */
 	virtual bool ImplementsTargetInterface(UObject* Target) const = 0;
 
+	/**
+	 * Returns true if the closest point only depends on the primitive collision, not on the target component.
+	 * Such primitives are evaluated once regardless of the number of targets, and skipped if their bounds are farther than the
+	 * closest result found so far.
+	 */
+	virtual bool IsClosestPointOnPrimitive() const { return false; }
+
 	/** Find the closest point on the given primitive using the distance function of the target interface. */
 	virtual bool GetClosestPointOnTarget(
 		const UActorComponent* Target, const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutClosestPoint,
@@ -129,6 +170,13 @@ private:
 
 	/** Poke normal from the closest point on the surface. */
 	FVector ClosestTargetNormal = FVector::ForwardVector;
+
+	/** Target and primitive closer than the focused target, waiting for the focus switch dwell time to pass. */
+	TWeakObjectPtr<UObject> PendingTargetWeak;
+	TWeakObjectPtr<UPrimitiveComponent> PendingPrimitiveWeak;
+
+	/** Time at which the pending target became the closest target. */
+	float PendingTime = 0.0f;
 };
 
 /** Focus implementation for the grab pointers. */
@@ -149,6 +197,8 @@ protected:
 
 	virtual bool ImplementsTargetInterface(UObject* Target) const override;
 
+	virtual bool IsClosestPointOnPrimitive() const override { return true; }
+
 	virtual bool GetClosestPointOnTarget(
 		const UActorComponent* Target, const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutClosestPoint,
 		FVector& OutNormal) const override;
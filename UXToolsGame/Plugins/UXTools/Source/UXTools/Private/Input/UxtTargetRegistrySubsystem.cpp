@@ -0,0 +1,561 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Input/UxtTargetRegistrySubsystem.h"
+
+#include "EngineUtils.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Interactions/UxtFarTarget.h"
+#include "Interactions/UxtGrabTarget.h"
+#include "Interactions/UxtPokeTarget.h"
+#include "PhysicsEngine/BodySetup.h"
+
+namespace
+{
+	bool HasNearTargetComponent(const AActor* Actor)
+	{
+		for (const UActorComponent* Component : Actor->GetComponents())
+		{
+			if (Component && (Component->Implements<UUxtGrabTarget>() || Component->Implements<UUxtPokeTarget>()))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool HasFarTargetComponent(const AActor* Actor)
+	{
+		for (const UActorComponent* Component : Actor->GetComponents())
+		{
+			if (Component && Component->Implements<UUxtFarTarget>())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Adds the primitives of the actor to the list if the actor owns target components, removes the actor otherwise. */
+	void UpdateTargetActor(
+		const TWeakObjectPtr<AActor>& ActorWeak, bool bIsTargetActor,
+		TMap<TWeakObjectPtr<AActor>, TArray<TWeakObjectPtr<UPrimitiveComponent>>>& InOutTargetActors)
+	{
+		if (!bIsTargetActor)
+		{
+			InOutTargetActors.Remove(ActorWeak);
+			return;
+		}
+
+		TArray<TWeakObjectPtr<UPrimitiveComponent>>& Primitives = InOutTargetActors.FindOrAdd(ActorWeak);
+		Primitives.Reset();
+
+		for (UActorComponent* Component : ActorWeak->GetComponents())
+		{
+			if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+			{
+				Primitives.Add(Primitive);
+			}
+		}
+	}
+
+	/** Hash of the simple collision shapes relevant for poking, without copying the aggregate geometry. */
+	uint32 HashPokeCollision(const UBodySetup* BodySetup)
+	{
+		if (!BodySetup)
+		{
+			return 0;
+		}
+
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		uint32 Hash = GetTypeHash(AggGeom.GetElementCount());
+		for (const FKBoxElem& Box : AggGeom.BoxElems)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Box.Center));
+			Hash = HashCombine(Hash, GetTypeHash(Box.Rotation.Euler()));
+			Hash = HashCombine(Hash, GetTypeHash(FVector(Box.X, Box.Y, Box.Z)));
+		}
+		return Hash;
+	}
+} // namespace
+
+FUxtPokeGeometry::FUxtPokeGeometry(const UPrimitiveComponent& Primitive)
+{
+	BodySetup = Primitive.GetBodySetup();
+	CollisionHash = HashPokeCollision(BodySetup);
+
+	if (BodySetup)
+	{
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		const int32 ElementCount = AggGeom.GetElementCount();
+		if (ElementCount != 0 && ElementCount == AggGeom.BoxElems.Num())
+		{
+			Shape = EShape::Box;
+		}
+	}
+
+	LocalBounds = Primitive.CalcLocalBounds();
+	FrontFace = FPlane(FVector::ForwardVector, LocalBounds.BoxExtent.X);
+}
+
+bool FUxtPokeGeometry::IsValidFor(const UPrimitiveComponent& Primitive) const
+{
+	const UBodySetup* CurrentBodySetup = Primitive.GetBodySetup();
+	return CurrentBodySetup == BodySetup && HashPokeCollision(CurrentBodySetup) == CollisionHash;
+}
+
+void UUxtTargetRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CreatePhysicsStateHandle =
+		UActorComponent::GlobalCreatePhysicsDelegate.AddUObject(this, &UUxtTargetRegistrySubsystem::OnCreatePhysicsState);
+	DestroyPhysicsStateHandle =
+		UActorComponent::GlobalDestroyPhysicsDelegate.AddUObject(this, &UUxtTargetRegistrySubsystem::OnDestroyPhysicsState);
+}
+
+void UUxtTargetRegistrySubsystem::Deinitialize()
+{
+	UActorComponent::GlobalCreatePhysicsDelegate.Remove(CreatePhysicsStateHandle);
+	UActorComponent::GlobalDestroyPhysicsDelegate.Remove(DestroyPhysicsStateHandle);
+	CreatePhysicsStateHandle.Reset();
+	DestroyPhysicsStateHandle.Reset();
+
+	DirtyActors.Empty();
+	TargetActors.Empty();
+	FarTargetActors.Empty();
+	FarTargetBounds.Empty();
+	FarTargetPrimitives.Empty();
+	GridEntries.Empty();
+	LargeEntries.Empty();
+	GridCells.Empty();
+	ComponentCache.Empty();
+	PokeGeometryCache.Empty();
+
+	Super::Deinitialize();
+}
+
+void UUxtTargetRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Primitives registered before the subsystem was created have not been reported
+	for (TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		DirtyActors.Add(*It);
+	}
+}
+
+void UUxtTargetRegistrySubsystem::InvalidateActor(AActor* Actor)
+{
+	if (Actor)
+	{
+		DirtyActors.Add(Actor);
+
+		// Keep the entry so that a list returned earlier is not freed while it is being iterated, it is rebuilt on next use
+		if (FActorComponentCache* Cache = ComponentCache.Find(Actor))
+		{
+			Cache->NumOwnedComponents = INDEX_NONE;
+		}
+	}
+}
+
+void UUxtTargetRegistrySubsystem::InvalidateOwner(const UActorComponent* Component)
+{
+	UWorld* World = Component->GetWorld();
+	if (UUxtTargetRegistrySubsystem* Registry = World ? World->GetSubsystem<UUxtTargetRegistrySubsystem>() : nullptr)
+	{
+		Registry->InvalidateActor(Component->GetOwner());
+	}
+}
+
+void UUxtTargetRegistrySubsystem::QueryProximity(
+	const FVector& Center, float Radius, ECollisionChannel TraceChannel, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+	OutPrimitives.Reset();
+
+	UpdateDirtyActors();
+
+	// Primitives can move at any time, rebuild the grid once per frame when first queried
+	if (GridFrame != GFrameCounter)
+	{
+		RebuildGrid();
+		GridFrame = GFrameCounter;
+	}
+
+	// Entries are stored in the cell containing their center and are at most one cell in size,
+	// so any overlapping entry is stored within one cell of the query bounds.
+	const FVector QueryExtent(Radius + CellSize);
+	const FIntVector MinCell = GetCell(Center - QueryExtent);
+	const FIntVector MaxCell = GetCell(Center + QueryExtent);
+	const int64 NumQueryCells =
+		int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1) * int64(MaxCell.Z - MinCell.Z + 1);
+
+	if (NumQueryCells > GridCells.Num())
+	{
+		// Query covers more cells than are occupied, visit occupied cells instead
+		for (const TPair<FIntVector, FCellRange>& Cell : GridCells)
+		{
+			if (Cell.Key.X >= MinCell.X && Cell.Key.X <= MaxCell.X && Cell.Key.Y >= MinCell.Y && Cell.Key.Y <= MaxCell.Y &&
+				Cell.Key.Z >= MinCell.Z && Cell.Key.Z <= MaxCell.Z)
+			{
+				for (int32 Index = Cell.Value.Start; Index < Cell.Value.Start + Cell.Value.Num; ++Index)
+				{
+					TestEntry(GridEntries[Index], Center, Radius, TraceChannel, OutPrimitives);
+				}
+			}
+		}
+	}
+	else
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+				{
+					if (const FCellRange* Range = GridCells.Find(FIntVector(X, Y, Z)))
+					{
+						for (int32 Index = Range->Start; Index < Range->Start + Range->Num; ++Index)
+						{
+							TestEntry(GridEntries[Index], Center, Radius, TraceChannel, OutPrimitives);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	for (const FGridEntry& Entry : LargeEntries)
+	{
+		TestEntry(Entry, Center, Radius, TraceChannel, OutPrimitives);
+	}
+}
+
+void UUxtTargetRegistrySubsystem::QueryCone(
+	const FVector& Origin, const FVector& Direction, float Length, float HalfAngle, ECollisionChannel TraceChannel,
+	TArray<FUxtConeQueryCandidate>& OutCandidates)
+{
+	OutCandidates.Reset();
+
+	UpdateDirtyActors();
+
+	// Primitives can move at any time, rebuild the bounds once per frame when first queried
+	if (FarTargetBoundsFrame != GFrameCounter)
+	{
+		RebuildFarTargetBounds();
+		FarTargetBoundsFrame = GFrameCounter;
+	}
+
+	for (int32 Index = 0; Index < FarTargetBounds.Num(); ++Index)
+	{
+		const FSphere& Bounds = FarTargetBounds[Index];
+		const FVector ToCenter = Bounds.Center - Origin;
+		const float CenterDepth = FVector::DotProduct(ToCenter, Direction);
+
+		// Discard bounds entirely behind the origin or beyond the cone length
+		if (CenterDepth + Bounds.W < 0.0f || CenterDepth - Bounds.W > Length)
+		{
+			continue;
+		}
+
+		// Angle to the closest point of the sphere, zero if the origin is inside the sphere
+		const float CenterDistance = ToCenter.Size();
+		float Angle = 0.0f;
+		if (CenterDistance > Bounds.W)
+		{
+			const float CenterAngle = FMath::Acos(FMath::Clamp(CenterDepth / CenterDistance, -1.0f, 1.0f));
+			Angle = FMath::Max(CenterAngle - FMath::Asin(Bounds.W / CenterDistance), 0.0f);
+		}
+
+		if (Angle > HalfAngle)
+		{
+			continue;
+		}
+
+		// Bounds are rebuilt once per frame, make sure the primitive has not been destroyed or changed since.
+		UPrimitiveComponent* Primitive = FarTargetPrimitives[Index].Get();
+		if (!IsValid(Primitive) || !Primitive->IsPhysicsStateCreated() || !Primitive->IsQueryCollisionEnabled() ||
+			Primitive->GetCollisionResponseToChannel(TraceChannel) != ECR_Block)
+		{
+			continue;
+		}
+
+		OutCandidates.Add({Primitive, Angle, FMath::Clamp(CenterDepth, 0.0f, Length)});
+	}
+}
+
+const FUxtComponentList& UUxtTargetRegistrySubsystem::GetCachedComponents(AActor* Actor, UClass* Class)
+{
+	check(Actor && Class);
+
+	FActorComponentCache* Cache = ComponentCache.Find(Actor);
+	if (!Cache)
+	{
+		if (ComponentCache.Num() >= ComponentCachePruneSize)
+		{
+			PruneComponentCache();
+		}
+
+		Cache = &ComponentCache.Add(Actor);
+	}
+
+	// Components can be added, removed or moved to another actor without any notification. Comparing the whole set costs as much
+	// as building the lists, so it is only done once per frame. UXT target components invalidate their owner when registered.
+	const TSet<UActorComponent*>& OwnedComponents = Actor->GetComponents();
+	if (Cache->ValidatedFrame != GFrameCounter || Cache->NumOwnedComponents != OwnedComponents.Num())
+	{
+		const uint32 ComponentsSignature = GetComponentsSignature(OwnedComponents);
+		if (Cache->NumOwnedComponents != OwnedComponents.Num() || Cache->ComponentsSignature != ComponentsSignature)
+		{
+			Cache->NumOwnedComponents = OwnedComponents.Num();
+			Cache->ComponentsSignature = ComponentsSignature;
+			Cache->Classes.Reset();
+		}
+		Cache->ValidatedFrame = GFrameCounter;
+	}
+
+	for (const FClassComponents& ClassComponents : Cache->Classes)
+	{
+		if (ClassComponents.Class == Class)
+		{
+			return ClassComponents.Components;
+		}
+	}
+
+	FClassComponents& ClassComponents = Cache->Classes.AddDefaulted_GetRef();
+	ClassComponents.Class = Class;
+
+	const bool bIsInterface = Class->HasAnyClassFlags(CLASS_Interface);
+	for (UActorComponent* Component : OwnedComponents)
+	{
+		if (Component && (bIsInterface ? Component->GetClass()->ImplementsInterface(Class) : Component->IsA(Class)))
+		{
+			ClassComponents.Components.Add(Component);
+		}
+	}
+
+	return ClassComponents.Components;
+}
+
+FUxtPokeGeometry UUxtTargetRegistrySubsystem::GetPokeGeometry(const UPrimitiveComponent* Primitive)
+{
+	check(Primitive);
+
+	FUxtPokeGeometry* Geometry = PokeGeometryCache.Find(Primitive);
+	if (!Geometry)
+	{
+		if (PokeGeometryCache.Num() >= PokeGeometryCachePruneSize)
+		{
+			PrunePokeGeometryCache();
+		}
+
+		return PokeGeometryCache.Add(Primitive, FUxtPokeGeometry(*Primitive));
+	}
+
+	if (!Geometry->IsValidFor(*Primitive))
+	{
+		*Geometry = FUxtPokeGeometry(*Primitive);
+	}
+
+	return *Geometry;
+}
+
+void UUxtTargetRegistrySubsystem::OnCreatePhysicsState(UActorComponent* Component)
+{
+	if (Component->GetWorld() == GetWorld() && Component->IsA<UPrimitiveComponent>())
+	{
+		PokeGeometryCache.Remove(CastChecked<UPrimitiveComponent>(Component));
+
+		if (AActor* Owner = Component->GetOwner())
+		{
+			DirtyActors.Add(Owner);
+		}
+	}
+}
+
+void UUxtTargetRegistrySubsystem::OnDestroyPhysicsState(UActorComponent* Component)
+{
+	if (Component->GetWorld() == GetWorld() && Component->IsA<UPrimitiveComponent>())
+	{
+		PokeGeometryCache.Remove(CastChecked<UPrimitiveComponent>(Component));
+
+		if (AActor* Owner = Component->GetOwner())
+		{
+			if (TargetActors.Contains(Owner) || FarTargetActors.Contains(Owner))
+			{
+				DirtyActors.Add(Owner);
+			}
+
+			if (Owner->IsActorBeingDestroyed())
+			{
+				ComponentCache.Remove(Owner);
+			}
+		}
+	}
+}
+
+void UUxtTargetRegistrySubsystem::PruneComponentCache()
+{
+	for (auto It = ComponentCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	ComponentCachePruneSize = FMath::Max(64, ComponentCache.Num() * 2);
+}
+
+void UUxtTargetRegistrySubsystem::PrunePokeGeometryCache()
+{
+	for (auto It = PokeGeometryCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	PokeGeometryCachePruneSize = FMath::Max(64, PokeGeometryCache.Num() * 2);
+}
+
+void UUxtTargetRegistrySubsystem::UpdateDirtyActors()
+{
+	if (DirtyActors.Num() == 0)
+	{
+		return;
+	}
+
+	for (const TWeakObjectPtr<AActor>& ActorWeak : DirtyActors)
+	{
+		const AActor* Actor = ActorWeak.Get();
+		const bool bIsValidActor = Actor && !Actor->IsActorBeingDestroyed();
+		UpdateTargetActor(ActorWeak, bIsValidActor && HasNearTargetComponent(Actor), TargetActors);
+		UpdateTargetActor(ActorWeak, bIsValidActor && HasFarTargetComponent(Actor), FarTargetActors);
+	}
+
+	DirtyActors.Reset();
+
+	// Force a rebuild of the grid and bounds to include the changes
+	GridFrame = MAX_uint64;
+	FarTargetBoundsFrame = MAX_uint64;
+}
+
+void UUxtTargetRegistrySubsystem::RebuildGrid()
+{
+	GridEntries.Reset();
+	LargeEntries.Reset();
+	GridCells.Reset();
+
+	for (const TPair<TWeakObjectPtr<AActor>, TArray<TWeakObjectPtr<UPrimitiveComponent>>>& TargetActor : TargetActors)
+	{
+		for (const TWeakObjectPtr<UPrimitiveComponent>& PrimitiveWeak : TargetActor.Value)
+		{
+			UPrimitiveComponent* Primitive = PrimitiveWeak.Get();
+			if (Primitive && Primitive->IsPhysicsStateCreated() && Primitive->IsQueryCollisionEnabled())
+			{
+				const FBox Bounds = Primitive->Bounds.GetBox();
+				const FGridEntry Entry = {Primitive, Bounds, GetCell(Bounds.GetCenter())};
+
+				if (Bounds.GetExtent().GetMax() * 2.0f > CellSize)
+				{
+					LargeEntries.Add(Entry);
+				}
+				else
+				{
+					GridEntries.Add(Entry);
+				}
+			}
+		}
+	}
+
+	GridEntries.Sort(
+		[](const FGridEntry& A, const FGridEntry& B)
+		{
+			if (A.Cell.X != B.Cell.X)
+			{
+				return A.Cell.X < B.Cell.X;
+			}
+			if (A.Cell.Y != B.Cell.Y)
+			{
+				return A.Cell.Y < B.Cell.Y;
+			}
+			return A.Cell.Z < B.Cell.Z;
+		});
+
+	for (int32 Index = 0; Index < GridEntries.Num(); ++Index)
+	{
+		if (FCellRange* Range = GridCells.Find(GridEntries[Index].Cell))
+		{
+			++Range->Num;
+		}
+		else
+		{
+			GridCells.Add(GridEntries[Index].Cell, {Index, 1});
+		}
+	}
+}
+
+void UUxtTargetRegistrySubsystem::RebuildFarTargetBounds()
+{
+	FarTargetBounds.Reset();
+	FarTargetPrimitives.Reset();
+
+	for (const TPair<TWeakObjectPtr<AActor>, TArray<TWeakObjectPtr<UPrimitiveComponent>>>& FarTargetActor : FarTargetActors)
+	{
+		for (const TWeakObjectPtr<UPrimitiveComponent>& PrimitiveWeak : FarTargetActor.Value)
+		{
+			UPrimitiveComponent* Primitive = PrimitiveWeak.Get();
+			if (Primitive && Primitive->IsPhysicsStateCreated() && Primitive->IsQueryCollisionEnabled())
+			{
+				FarTargetBounds.Add(FSphere(Primitive->Bounds.Origin, Primitive->Bounds.SphereRadius));
+				FarTargetPrimitives.Add(Primitive);
+			}
+		}
+	}
+}
+
+void UUxtTargetRegistrySubsystem::TestEntry(
+	const FGridEntry& Entry, const FVector& Center, float Radius, ECollisionChannel TraceChannel,
+	TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (!FMath::SphereAABBIntersection(Center, FMath::Square(Radius), Entry.Bounds))
+	{
+		return;
+	}
+
+	// Entries are rebuilt once per frame, make sure the primitive has not been destroyed or changed since.
+	UPrimitiveComponent* Primitive = Entry.Primitive.Get();
+	if (!IsValid(Primitive) || !Primitive->IsPhysicsStateCreated() || !Primitive->IsQueryCollisionEnabled() ||
+		Primitive->GetCollisionResponseToChannel(TraceChannel) == ECR_Ignore)
+	{
+		return;
+	}
+
+	if (Primitive->OverlapComponent(Center, FQuat::Identity, FCollisionShape::MakeSphere(Radius)))
+	{
+		OutPrimitives.Add(Primitive);
+	}
+}
+
+FIntVector UUxtTargetRegistrySubsystem::GetCell(const FVector& Location)
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize), FMath::FloorToInt(Location.Z / CellSize));
+}
+
+uint32 UUxtTargetRegistrySubsystem::GetComponentsSignature(const TSet<UActorComponent*>& OwnedComponents)
+{
+	uint32 Signature = 0;
+	for (UActorComponent* Component : OwnedComponents)
+	{
+		// Summing keeps the signature independent of the set order
+		Signature += GetTypeHash(FWeakObjectPtr(Component));
+	}
+	return Signature;
+}
@@ -4,9 +4,42 @@
 #include "Interactions/Constraints/UxtTransformConstraint.h"
 
 #include "GameFramework/Actor.h"
+#include "Interactions/UxtManipulatorComponent.h"
 #include "Utils/UxtFunctionLibrary.h"
 
 void UUxtTransformConstraint::Initialize(const FTransform& WorldPose)
 {
 	WorldPoseOnManipulationStart = WorldPose;
 }
+
+void UUxtTransformConstraint::OnRegister()
+{
+	Super::OnRegister();
+
+	if (AActor* Owner = GetOwner())
+	{
+		for (UActorComponent* Component : Owner->GetComponents())
+		{
+			if (UUxtManipulatorComponent* Manipulator = Cast<UUxtManipulatorComponent>(Component))
+			{
+				Manipulator->OnConstraintRegistered(this);
+			}
+		}
+	}
+}
+
+void UUxtTransformConstraint::OnUnregister()
+{
+	if (AActor* Owner = GetOwner())
+	{
+		for (UActorComponent* Component : Owner->GetComponents())
+		{
+			if (UUxtManipulatorComponent* Manipulator = Cast<UUxtManipulatorComponent>(Component))
+			{
+				Manipulator->OnConstraintUnregistered(this);
+			}
+		}
+	}
+
+	Super::OnUnregister();
+}
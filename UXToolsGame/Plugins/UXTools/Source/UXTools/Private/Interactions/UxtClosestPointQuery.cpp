@@ -0,0 +1,414 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Interactions/UxtClosestPointQuery.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/ShapeComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+
+namespace
+{
+	constexpr int32 NumLanes = 4;
+
+	/**
+	 * Four boxes in structure of arrays layout.
+	 * Positions are relative to the query point, so that the kernel can work in single precision.
+	 */
+	struct alignas(16) FBoxLanes
+	{
+		float CenterX[NumLanes];
+		float CenterY[NumLanes];
+		float CenterZ[NumLanes];
+		/** Components of the box axes, indexed by axis. */
+		float AxisX[3][NumLanes];
+		float AxisY[3][NumLanes];
+		float AxisZ[3][NumLanes];
+		/** Half extents, indexed by axis. */
+		float Extent[3][NumLanes];
+		int32 Owner[NumLanes];
+	};
+
+	/** Four capsules in structure of arrays layout, relative to the query point. */
+	struct alignas(16) FCapsuleLanes
+	{
+		float StartX[NumLanes];
+		float StartY[NumLanes];
+		float StartZ[NumLanes];
+		float SegmentX[NumLanes];
+		float SegmentY[NumLanes];
+		float SegmentZ[NumLanes];
+		float InvSegmentLengthSqr[NumLanes];
+		float Radius[NumLanes];
+		int32 Owner[NumLanes];
+	};
+
+	/** Sphere relative to the query point. Capsules become spheres once the closest point on their segment is known. */
+	struct FSphere
+	{
+		FVector3f Center;
+		float Radius;
+		int32 Owner;
+	};
+
+	/** Closest point of a primitive as an offset from the query point. */
+	struct FPrimitiveResult
+	{
+		FVector3f Offset;
+		float DistanceSqr;
+	};
+
+	/** Scale is considered uniform if components differ by less than this fraction. */
+	const float UniformScaleTolerance = 1.e-3f;
+
+	bool IsUniformScale(const FVector& AbsScale)
+	{
+		return AbsScale.GetMax() - AbsScale.GetMin() <= UniformScaleTolerance * AbsScale.GetMax();
+	}
+
+	const FKAggregateGeom* GetAnalyticGeometry(const UPrimitiveComponent* Primitive)
+	{
+		// Instanced meshes have one body per instance, which the body setup doesn't describe
+		if (!Primitive->IsA<UStaticMeshComponent>() && !Primitive->IsA<UShapeComponent>())
+		{
+			return nullptr;
+		}
+		if (Primitive->IsA<UInstancedStaticMeshComponent>())
+		{
+			return nullptr;
+		}
+
+		// Shape components update their body setup on demand, which requires non-const access
+		UBodySetup* BodySetup = const_cast<UPrimitiveComponent*>(Primitive)->GetBodySetup();
+		if (!BodySetup || BodySetup->GetCollisionTraceFlag() == CTF_UseComplexAsSimple)
+		{
+			return nullptr;
+		}
+
+		const FKAggregateGeom& Geometry = BodySetup->AggGeom;
+		if (Geometry.ConvexElems.Num() > 0 || Geometry.TaperedCapsuleElems.Num() > 0 || Geometry.GetElementCount() == 0)
+		{
+			return nullptr;
+		}
+
+		// Physics approximates scaled spheres, capsules and rotated boxes when scale is non-uniform, don't try to match it
+		if (!IsUniformScale(Primitive->GetComponentTransform().GetScale3D().GetAbs()))
+		{
+			if (Geometry.SphereElems.Num() > 0 || Geometry.SphylElems.Num() > 0)
+			{
+				return nullptr;
+			}
+			for (const FKBoxElem& Box : Geometry.BoxElems)
+			{
+				if (!Box.Rotation.IsNearlyZero())
+				{
+					return nullptr;
+				}
+			}
+		}
+
+		return &Geometry;
+	}
+
+	/** Collects shapes of several primitives and evaluates their closest points to a single query point. */
+	class FClosestPointBatch
+	{
+	public:
+		explicit FClosestPointBatch(const FVector& InPoint) : Point(InPoint) {}
+
+		/** Add the collision shapes of a primitive. The geometry must have been validated with GetAnalyticGeometry. */
+		void AddPrimitive(const UPrimitiveComponent* Primitive, const FKAggregateGeom& Geometry, int32 Owner)
+		{
+			const FTransform& ComponentTransform = Primitive->GetComponentTransform();
+			const FQuat ComponentRotation = ComponentTransform.GetRotation();
+			const FVector Scale = ComponentTransform.GetScale3D().GetAbs();
+
+			for (const FKBoxElem& Box : Geometry.BoxElems)
+			{
+				const FVector3f Center(ComponentTransform.TransformPosition(Box.Center) - Point);
+				const FQuat Rotation = ComponentRotation * Box.Rotation.Quaternion();
+				const FVector3f Extent(FVector(Box.X, Box.Y, Box.Z) * 0.5f * Scale);
+				const FVector3f Axes[3] = {FVector3f(Rotation.GetAxisX()), FVector3f(Rotation.GetAxisY()), FVector3f(Rotation.GetAxisZ())};
+
+				int32 Lane;
+				FBoxLanes& Lanes = AddLane(BoxLanes, NumBoxes, Lane);
+				Lanes.CenterX[Lane] = Center.X;
+				Lanes.CenterY[Lane] = Center.Y;
+				Lanes.CenterZ[Lane] = Center.Z;
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					Lanes.AxisX[Axis][Lane] = Axes[Axis].X;
+					Lanes.AxisY[Axis][Lane] = Axes[Axis].Y;
+					Lanes.AxisZ[Axis][Lane] = Axes[Axis].Z;
+					Lanes.Extent[Axis][Lane] = Extent[Axis];
+				}
+				Lanes.Owner[Lane] = Owner;
+			}
+
+			// Spheres and capsules are only used with uniform scale
+			const float UniformScale = static_cast<float>(Scale.X);
+
+			for (const FKSphereElem& Sphere : Geometry.SphereElems)
+			{
+				const FVector3f Center(ComponentTransform.TransformPosition(Sphere.Center) - Point);
+				Spheres.Add({Center, Sphere.Radius * UniformScale, Owner});
+			}
+
+			for (const FKSphylElem& Capsule : Geometry.SphylElems)
+			{
+				const FVector3f Center(ComponentTransform.TransformPosition(Capsule.Center) - Point);
+				const FVector3f Axis((ComponentRotation * Capsule.Rotation.Quaternion()).GetAxisZ());
+				const FVector3f Segment = Axis * Capsule.Length * UniformScale;
+				const FVector3f Start = Center - Segment * 0.5f;
+				const float SegmentLengthSqr = Segment.SizeSquared();
+
+				int32 Lane;
+				FCapsuleLanes& Lanes = AddLane(CapsuleLanes, NumCapsules, Lane);
+				Lanes.StartX[Lane] = Start.X;
+				Lanes.StartY[Lane] = Start.Y;
+				Lanes.StartZ[Lane] = Start.Z;
+				Lanes.SegmentX[Lane] = Segment.X;
+				Lanes.SegmentY[Lane] = Segment.Y;
+				Lanes.SegmentZ[Lane] = Segment.Z;
+				Lanes.InvSegmentLengthSqr[Lane] = SegmentLengthSqr > SMALL_NUMBER ? 1.0f / SegmentLengthSqr : 0.0f;
+				Lanes.Radius[Lane] = Capsule.Radius * UniformScale;
+				Lanes.Owner[Lane] = Owner;
+			}
+		}
+
+		/** Compute the closest point of all added shapes, keeping the closest one per owner. Results must be initialized. */
+		void Evaluate(TArrayView<FPrimitiveResult> Results)
+		{
+			EvaluateBoxes(Results);
+			EvaluateCapsules();
+			EvaluateSpheres(Results);
+		}
+
+	private:
+		template <typename LanesType, typename AllocatorType>
+		static LanesType& AddLane(TArray<LanesType, AllocatorType>& Lanes, int32& NumShapes, int32& OutLane)
+		{
+			OutLane = NumShapes % NumLanes;
+			if (OutLane == 0)
+			{
+				// Unused lanes stay zeroed, they are evaluated but their results are ignored
+				Lanes.AddZeroed();
+			}
+			++NumShapes;
+			return Lanes.Last();
+		}
+
+		static void UpdateResult(FPrimitiveResult& Result, const FVector3f& Offset, float DistanceSqr)
+		{
+			if (Result.DistanceSqr < 0.0f || DistanceSqr < Result.DistanceSqr)
+			{
+				Result.Offset = Offset;
+				Result.DistanceSqr = DistanceSqr;
+			}
+		}
+
+		void EvaluateBoxes(TArrayView<FPrimitiveResult> Results) const
+		{
+			for (int32 GroupIndex = 0; GroupIndex < BoxLanes.Num(); ++GroupIndex)
+			{
+				const FBoxLanes& Lanes = BoxLanes[GroupIndex];
+
+				const VectorRegister4Float CenterX = VectorLoadAligned(Lanes.CenterX);
+				const VectorRegister4Float CenterY = VectorLoadAligned(Lanes.CenterY);
+				const VectorRegister4Float CenterZ = VectorLoadAligned(Lanes.CenterZ);
+
+				VectorRegister4Float OffsetX = VectorSetFloat1(0.0f);
+				VectorRegister4Float OffsetY = VectorSetFloat1(0.0f);
+				VectorRegister4Float OffsetZ = VectorSetFloat1(0.0f);
+				VectorRegister4Float DistanceSqr = VectorSetFloat1(0.0f);
+
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					const VectorRegister4Float AxisX = VectorLoadAligned(Lanes.AxisX[Axis]);
+					const VectorRegister4Float AxisY = VectorLoadAligned(Lanes.AxisY[Axis]);
+					const VectorRegister4Float AxisZ = VectorLoadAligned(Lanes.AxisZ[Axis]);
+					const VectorRegister4Float Extent = VectorLoadAligned(Lanes.Extent[Axis]);
+
+					// Coordinate of the query point along the box axis, the query point being the origin
+					const VectorRegister4Float Coord =
+						VectorNegate(VectorMultiplyAdd(CenterX, AxisX, VectorMultiplyAdd(CenterY, AxisY, VectorMultiply(CenterZ, AxisZ))));
+					const VectorRegister4Float Clamped = VectorMin(VectorMax(Coord, VectorNegate(Extent)), Extent);
+
+					// Offset is exactly zero for points inside the box
+					const VectorRegister4Float Delta = VectorSubtract(Clamped, Coord);
+					DistanceSqr = VectorMultiplyAdd(Delta, Delta, DistanceSqr);
+					OffsetX = VectorMultiplyAdd(Delta, AxisX, OffsetX);
+					OffsetY = VectorMultiplyAdd(Delta, AxisY, OffsetY);
+					OffsetZ = VectorMultiplyAdd(Delta, AxisZ, OffsetZ);
+				}
+
+				alignas(16) float OutOffsetX[NumLanes];
+				alignas(16) float OutOffsetY[NumLanes];
+				alignas(16) float OutOffsetZ[NumLanes];
+				alignas(16) float OutDistanceSqr[NumLanes];
+				VectorStoreAligned(OffsetX, OutOffsetX);
+				VectorStoreAligned(OffsetY, OutOffsetY);
+				VectorStoreAligned(OffsetZ, OutOffsetZ);
+				VectorStoreAligned(DistanceSqr, OutDistanceSqr);
+
+				const int32 NumUsedLanes = FMath::Min(NumBoxes - GroupIndex * NumLanes, NumLanes);
+				for (int32 Lane = 0; Lane < NumUsedLanes; ++Lane)
+				{
+					UpdateResult(
+						Results[Lanes.Owner[Lane]], FVector3f(OutOffsetX[Lane], OutOffsetY[Lane], OutOffsetZ[Lane]), OutDistanceSqr[Lane]);
+				}
+			}
+		}
+
+		/** Find the closest point on each capsule segment and add it as a sphere. */
+		void EvaluateCapsules()
+		{
+			for (int32 GroupIndex = 0; GroupIndex < CapsuleLanes.Num(); ++GroupIndex)
+			{
+				const FCapsuleLanes& Lanes = CapsuleLanes[GroupIndex];
+
+				const VectorRegister4Float StartX = VectorLoadAligned(Lanes.StartX);
+				const VectorRegister4Float StartY = VectorLoadAligned(Lanes.StartY);
+				const VectorRegister4Float StartZ = VectorLoadAligned(Lanes.StartZ);
+				const VectorRegister4Float SegmentX = VectorLoadAligned(Lanes.SegmentX);
+				const VectorRegister4Float SegmentY = VectorLoadAligned(Lanes.SegmentY);
+				const VectorRegister4Float SegmentZ = VectorLoadAligned(Lanes.SegmentZ);
+
+				// Projection of the query point (the origin) on the segment, clamped to the segment ends
+				const VectorRegister4Float Projection = VectorNegate(
+					VectorMultiplyAdd(StartX, SegmentX, VectorMultiplyAdd(StartY, SegmentY, VectorMultiply(StartZ, SegmentZ))));
+				const VectorRegister4Float T = VectorMin(
+					VectorMax(VectorMultiply(Projection, VectorLoadAligned(Lanes.InvSegmentLengthSqr)), VectorSetFloat1(0.0f)),
+					VectorSetFloat1(1.0f));
+
+				alignas(16) float OutX[NumLanes];
+				alignas(16) float OutY[NumLanes];
+				alignas(16) float OutZ[NumLanes];
+				VectorStoreAligned(VectorMultiplyAdd(SegmentX, T, StartX), OutX);
+				VectorStoreAligned(VectorMultiplyAdd(SegmentY, T, StartY), OutY);
+				VectorStoreAligned(VectorMultiplyAdd(SegmentZ, T, StartZ), OutZ);
+
+				const int32 NumUsedLanes = FMath::Min(NumCapsules - GroupIndex * NumLanes, NumLanes);
+				for (int32 Lane = 0; Lane < NumUsedLanes; ++Lane)
+				{
+					Spheres.Add({FVector3f(OutX[Lane], OutY[Lane], OutZ[Lane]), Lanes.Radius[Lane], Lanes.Owner[Lane]});
+				}
+			}
+		}
+
+		void EvaluateSpheres(TArrayView<FPrimitiveResult> Results) const
+		{
+			for (const FSphere& Sphere : Spheres)
+			{
+				// The query point is the origin, so the center is also the vector from the query point to the center
+				const float CenterDistance = Sphere.Center.Size();
+				if (CenterDistance <= Sphere.Radius)
+				{
+					UpdateResult(Results[Sphere.Owner], FVector3f::ZeroVector, 0.0f);
+				}
+				else
+				{
+					const float Distance = CenterDistance - Sphere.Radius;
+					UpdateResult(Results[Sphere.Owner], Sphere.Center * (Distance / CenterDistance), Distance * Distance);
+				}
+			}
+		}
+
+		FVector Point;
+
+		TArray<FBoxLanes, TInlineAllocator<2>> BoxLanes;
+		int32 NumBoxes = 0;
+
+		TArray<FCapsuleLanes, TInlineAllocator<1>> CapsuleLanes;
+		int32 NumCapsules = 0;
+
+		TArray<FSphere, TInlineAllocator<4>> Spheres;
+	};
+
+	bool HasQueryCollision(const UPrimitiveComponent* Primitive)
+	{
+		return Primitive && Primitive->IsRegistered() && Primitive->IsCollisionEnabled();
+	}
+
+	bool GetPhysicsClosestPoint(
+		const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutPointOnSurface, float& OutDistanceSqr)
+	{
+		FVector ClosestPoint;
+		float DistanceSqr = -1.f;
+
+		if (Primitive->GetSquaredDistanceToCollision(Point, DistanceSqr, ClosestPoint))
+		{
+			OutPointOnSurface = ClosestPoint;
+			OutDistanceSqr = DistanceSqr;
+			return true;
+		}
+
+		return false;
+	}
+} // namespace
+
+bool FUxtClosestPointQuery::IsAnalyticPrimitive(const UPrimitiveComponent* Primitive)
+{
+	// Without physics state the physics query fails, keep results consistent with it
+	return HasQueryCollision(Primitive) && Primitive->IsPhysicsStateCreated() && GetAnalyticGeometry(Primitive) != nullptr;
+}
+
+bool FUxtClosestPointQuery::GetClosestPoint(
+	const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutPointOnSurface, float& OutDistanceSqr)
+{
+	GetClosestPoints(MakeArrayView(&Primitive, 1), Point, MakeArrayView(&OutPointOnSurface, 1), MakeArrayView(&OutDistanceSqr, 1));
+	return OutDistanceSqr >= 0.0f;
+}
+
+void FUxtClosestPointQuery::GetClosestPoints(
+	TArrayView<const UPrimitiveComponent* const> Primitives, const FVector& Point, TArrayView<FVector> OutPointsOnSurface,
+	TArrayView<float> OutDistancesSqr)
+{
+	check(OutPointsOnSurface.Num() >= Primitives.Num() && OutDistancesSqr.Num() >= Primitives.Num());
+
+	FClosestPointBatch Batch(Point);
+	TArray<FPrimitiveResult, TInlineAllocator<16>> Results;
+	Results.SetNumUninitialized(Primitives.Num());
+
+	bool bHasAnalyticPrimitives = false;
+	for (int32 Index = 0; Index < Primitives.Num(); ++Index)
+	{
+		const UPrimitiveComponent* Primitive = Primitives[Index];
+
+		OutPointsOnSurface[Index] = Point;
+		OutDistancesSqr[Index] = -1.f;
+		Results[Index] = {FVector3f::ZeroVector, -1.f};
+
+		if (HasQueryCollision(Primitive) && Primitive->IsPhysicsStateCreated())
+		{
+			if (const FKAggregateGeom* Geometry = GetAnalyticGeometry(Primitive))
+			{
+				Batch.AddPrimitive(Primitive, *Geometry, Index);
+				bHasAnalyticPrimitives = true;
+				continue;
+			}
+		}
+
+		if (HasQueryCollision(Primitive))
+		{
+			GetPhysicsClosestPoint(Primitive, Point, OutPointsOnSurface[Index], OutDistancesSqr[Index]);
+		}
+	}
+
+	if (bHasAnalyticPrimitives)
+	{
+		Batch.Evaluate(Results);
+
+		for (int32 Index = 0; Index < Primitives.Num(); ++Index)
+		{
+			if (Results[Index].DistanceSqr >= 0.0f)
+			{
+				// Points inside the collision keep the exact query point
+				OutPointsOnSurface[Index] = Point + FVector(Results[Index].Offset);
+				OutDistancesSqr[Index] = Results[Index].DistanceSqr;
+			}
+		}
+	}
+}
@@ -7,6 +7,7 @@
 #include "HandTracking/IUxtHandTracker.h"
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Interactions/UxtInteractionMode.h"
 #include "Interactions/UxtInteractionUtils.h"
 
@@ -14,13 +15,8 @@ namespace
 {
 	FTransform GetHandGripTransform(EControllerHand Hand)
 	{
-		FQuat GripOrientation;
-		FVector GripPosition;
-		if (IUxtHandTracker::Get().GetGripPose(Hand, GripOrientation, GripPosition))
-		{
-			return FTransform{GripOrientation, GripPosition};
-		}
-		return FTransform::Identity;
+		// Identity if the grip pose is not available
+		return IUxtHandTracker::Get().GetHandFrame(Hand).GetGripTransform();
 	}
 } // namespace
 
@@ -281,6 +277,18 @@ void UUxtGrabTargetComponent::UpdateComponentTickEnabled()
 	}
 }
 
+void UUxtGrabTargetComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtGrabTargetComponent::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 void UUxtGrabTargetComponent::BeginPlay()
 {
 	Super::BeginPlay();
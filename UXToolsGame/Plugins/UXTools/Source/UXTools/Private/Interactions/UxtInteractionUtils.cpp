@@ -5,6 +5,7 @@
 
 #include "Components/PrimitiveComponent.h"
 #include "GameFramework/Actor.h"
+#include "Interactions/UxtClosestPointQuery.h"
 
 bool FUxtInteractionUtils::GetDefaultClosestPointOnPrimitive(
 	const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutPointOnSurface, float& OutDistanceSqr)
@@ -14,6 +15,12 @@ bool FUxtInteractionUtils::GetDefaultClosestPointOnPrimitive(
 
 	if (Primitive->IsRegistered() && Primitive->IsCollisionEnabled())
 	{
+		// Simple collision shapes don't need a physics query
+		if (FUxtClosestPointQuery::IsAnalyticPrimitive(Primitive))
+		{
+			return FUxtClosestPointQuery::GetClosestPoint(Primitive, Point, OutPointOnSurface, OutDistanceSqr);
+		}
+
 		FVector ClosestPoint;
 		float DistanceSqr = -1.f;
 
@@ -97,6 +97,24 @@ void UUxtManipulatorComponent::SetMaxScale(const float Value)
 	MaxScale = FMath::Max(Value, FloorValue);
 }
 
+void UUxtManipulatorComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	// Pick up constraints registered before this component, later ones notify it themselves
+	UpdateActiveConstraints();
+}
+
+void UUxtManipulatorComponent::OnUnregister()
+{
+	ActiveConstraints.Empty();
+	TranslationConstraints.Empty();
+	RotationConstraints.Empty();
+	ScalingConstraints.Empty();
+
+	Super::OnUnregister();
+}
+
 void UUxtManipulatorComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -114,16 +132,6 @@ void UUxtManipulatorComponent::BeginPlay()
 	}
 }
 
-void UUxtManipulatorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	if (bAutoDetectConstraints)
-	{
-		UpdateActiveConstraints();
-	}
-}
-
 #if WITH_EDITOR
 void UUxtManipulatorComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -143,6 +151,12 @@ void UUxtManipulatorComponent::PostEditChangeProperty(FPropertyChangedEvent& Pro
 		{
 			SetMaxScale(MaxScale);
 		}
+		else if (
+			PropertyName.IsEqual(GET_MEMBER_NAME_CHECKED(UUxtManipulatorComponent, bAutoDetectConstraints)) ||
+			PropertyName.IsEqual(GET_MEMBER_NAME_CHECKED(UUxtManipulatorComponent, SelectedConstraints)))
+		{
+			UpdateActiveConstraints();
+		}
 	}
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 }
@@ -152,7 +166,6 @@ void UUxtManipulatorComponent::InitializeConstraints(USceneComponent* NewTargetC
 {
 	check(NewTargetComponent);
 	TargetComponent = NewTargetComponent;
-	ActiveConstraints = GetConstraints();
 
 	for (UUxtTransformConstraint* Constraint : ActiveConstraints)
 	{
@@ -171,10 +184,9 @@ void UUxtManipulatorComponent::ApplyConstraints(
 		ApplyImplicitScalingConstraint(Transform, GetMinScaleVec(), GetMaxScaleVec());
 	}
 
-	for (const UUxtTransformConstraint* Constraint : ActiveConstraints)
+	for (const UUxtTransformConstraint* Constraint : GetModeConstraints(TransformMode))
 	{
-		if (Constraint->GetConstraintType() == TransformMode && Constraint->HandType & GrabMode &&
-			Constraint->InteractionMode & InteractionMode)
+		if (Constraint->HandType & GrabMode && Constraint->InteractionMode & InteractionMode)
 		{
 			Constraint->ApplyConstraint(Transform);
 		}
@@ -208,34 +220,89 @@ TArray<UUxtTransformConstraint*> UUxtManipulatorComponent::GetConstraints() cons
 	return Constraints;
 }
 
-void UUxtManipulatorComponent::UpdateActiveConstraints()
+void UUxtManipulatorComponent::OnConstraintRegistered(UUxtTransformConstraint* Constraint)
 {
-	if (!TargetComponent)
+	if (!bAutoDetectConstraints)
 	{
-		// Don't update constraints if we don't have a target component.
-		return;
+		// Selected constraint references may resolve to the new component
+		UpdateActiveConstraints();
 	}
-
-	int NewConstraints = 0;
-	int ExistingConstraints = 0;
-	TArray<UUxtTransformConstraint*> Constraints = GetConstraints();
-
-	for (UUxtTransformConstraint* Constraint : Constraints)
+	else if (!ActiveConstraints.Contains(Constraint))
 	{
-		if (ActiveConstraints.Contains(Constraint))
+		AddActiveConstraint(Constraint);
+
+		if (TargetComponent)
 		{
-			ExistingConstraints++;
+			Constraint->Initialize(TargetComponent->GetComponentTransform());
 		}
-		else
+	}
+}
+
+void UUxtManipulatorComponent::OnConstraintUnregistered(UUxtTransformConstraint* Constraint)
+{
+	if (ActiveConstraints.Remove(Constraint) > 0)
+	{
+		// Remove keeps the order of the remaining constraints
+		TranslationConstraints.Remove(Constraint);
+		RotationConstraints.Remove(Constraint);
+		ScalingConstraints.Remove(Constraint);
+	}
+}
+
+void UUxtManipulatorComponent::UpdateActiveConstraints()
+{
+	const TArray<UUxtTransformConstraint*> PreviousConstraints = MoveTemp(ActiveConstraints);
+	ActiveConstraints.Reset();
+	TranslationConstraints.Reset();
+	RotationConstraints.Reset();
+	ScalingConstraints.Reset();
+
+	for (UUxtTransformConstraint* Constraint : GetConstraints())
+	{
+		AddActiveConstraint(Constraint);
+
+		// Constraints are initialized on manipulation start, only new ones need initializing during a manipulation
+		if (TargetComponent && !PreviousConstraints.Contains(Constraint))
 		{
 			Constraint->Initialize(TargetComponent->GetComponentTransform());
-			NewConstraints++;
 		}
 	}
+}
+
+void UUxtManipulatorComponent::AddActiveConstraint(UUxtTransformConstraint* Constraint)
+{
+	ActiveConstraints.Add(Constraint);
+
+	switch (Constraint->GetConstraintType())
+	{
+	case EUxtTransformMode::Translation:
+		TranslationConstraints.Add(Constraint);
+		break;
+	case EUxtTransformMode::Rotation:
+		RotationConstraints.Add(Constraint);
+		break;
+	case EUxtTransformMode::Scaling:
+		ScalingConstraints.Add(Constraint);
+		break;
+	default:
+		break;
+	}
+}
+
+const TArray<UUxtTransformConstraint*>& UUxtManipulatorComponent::GetModeConstraints(EUxtTransformMode TransformMode) const
+{
+	static const TArray<UUxtTransformConstraint*> NoConstraints;
 
-	if (NewConstraints > 0 || ExistingConstraints < ActiveConstraints.Num())
+	switch (TransformMode)
 	{
-		ActiveConstraints = Constraints;
+	case EUxtTransformMode::Translation:
+		return TranslationConstraints;
+	case EUxtTransformMode::Rotation:
+		return RotationConstraints;
+	case EUxtTransformMode::Scaling:
+		return ScalingConstraints;
+	default:
+		return NoConstraints;
 	}
 }
 
@@ -12,6 +12,7 @@
 #include "Engine/Selection.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/World.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
 #include "Tooltips/UxtTooltipActor.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Utils/UxtFunctionLibrary.h"
@@ -21,6 +22,18 @@ UUxtTooltipSpawnerComponent::UUxtTooltipSpawnerComponent(const FObjectInitialize
 	SetMobility(EComponentMobility::Movable);
 }
 
+void UUxtTooltipSpawnerComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+}
+
+void UUxtTooltipSpawnerComponent::OnUnregister()
+{
+	UUxtTargetRegistrySubsystem::InvalidateOwner(this);
+	Super::OnUnregister();
+}
+
 void UUxtTooltipSpawnerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	if (UWorld* World = GetWorld())
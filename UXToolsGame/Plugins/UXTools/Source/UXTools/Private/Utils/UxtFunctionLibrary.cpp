@@ -6,7 +6,10 @@
 #include "AudioDevice.h"
 #include "HeadMountedDisplayFunctionLibrary.h"
 
+#include "Engine/Engine.h"
+#include "HandTracking/IUxtHandTracker.h"
 #include "Kismet/GameplayStatics.h"
+#include "Utils/UxtHeadPoseSubsystem.h"
 #if WITH_EDITOR
 #include "Editor/EditorEngine.h"
 #endif
@@ -17,6 +20,19 @@ FTransform UUxtFunctionLibrary::TestHeadPose = FTransform::Identity;
 FTransform UUxtFunctionLibrary::SimulatedHeadPose = FTransform::Identity;
 
 FTransform UUxtFunctionLibrary::GetHeadPose(UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		if (UUxtHeadPoseSubsystem* HeadPoseSubsystem = World->GetSubsystem<UUxtHeadPoseSubsystem>())
+		{
+			return HeadPoseSubsystem->GetHeadPose();
+		}
+	}
+
+	return QueryHeadPose(WorldContextObject);
+}
+
+FTransform UUxtFunctionLibrary::QueryHeadPose(UObject* WorldContextObject)
 {
 	if (bUseTestData)
 	{
@@ -41,6 +57,26 @@ FTransform UUxtFunctionLibrary::GetHeadPose(UObject* WorldContextObject)
 	return Result;
 }
 
+void UUxtFunctionLibrary::SetHandJointFilterSettings(const FUxtHandJointFilterSettings& Settings)
+{
+	IUxtHandTracker::Get().SetJointFilterSettings(Settings);
+}
+
+FUxtHandJointFilterSettings UUxtFunctionLibrary::GetHandJointFilterSettings()
+{
+	return IUxtHandTracker::Get().GetJointFilterSettings();
+}
+
+void UUxtFunctionLibrary::SetHandPredictionSettings(const FUxtHandPredictionSettings& Settings)
+{
+	IUxtHandTracker::Get().SetPredictionSettings(Settings);
+}
+
+FUxtHandPredictionSettings UUxtFunctionLibrary::GetHandPredictionSettings()
+{
+	return IUxtHandTracker::Get().GetPredictionSettings();
+}
+
 bool UUxtFunctionLibrary::IsInEditor()
 {
 #if WITH_EDITOR
@@ -0,0 +1,150 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Utils/UxtHeadPoseSubsystem.h"
+
+#include "Engine/World.h"
+#include "Utils/UxtFunctionLibrary.h"
+
+void UUxtHeadPoseSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UUxtHeadPoseSubsystem::OnWorldPreActorTick);
+}
+
+void UUxtHeadPoseSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	PreActorTickHandle.Reset();
+
+	History.Empty();
+	HistoryHead = INDEX_NONE;
+
+	Super::Deinitialize();
+}
+
+FTransform UUxtHeadPoseSubsystem::GetHeadPose()
+{
+	if (UUxtFunctionLibrary::bUseTestData)
+	{
+		return UUxtFunctionLibrary::TestHeadPose;
+	}
+
+	if (UUxtFunctionLibrary::bUseInputSim)
+	{
+		return UUxtFunctionLibrary::SimulatedHeadPose;
+	}
+
+	UpdateHeadPose();
+	return GetSample(0).Pose;
+}
+
+FVector UUxtHeadPoseSubsystem::GetHeadLinearVelocity()
+{
+	UpdateHeadPose();
+
+	const FHeadPoseSample& Newest = GetSample(0);
+	const FHeadPoseSample& Reference = GetVelocityReferenceSample();
+	const double DeltaTime = Newest.Time - Reference.Time;
+	if (DeltaTime <= 0.0)
+	{
+		return FVector::ZeroVector;
+	}
+
+	return (Newest.Pose.GetLocation() - Reference.Pose.GetLocation()) / DeltaTime;
+}
+
+FVector UUxtHeadPoseSubsystem::GetHeadAngularVelocity()
+{
+	UpdateHeadPose();
+
+	const FHeadPoseSample& Newest = GetSample(0);
+	const FHeadPoseSample& Reference = GetVelocityReferenceSample();
+	const double DeltaTime = Newest.Time - Reference.Time;
+	if (DeltaTime <= 0.0)
+	{
+		return FVector::ZeroVector;
+	}
+
+	// Rotation from the reference to the newest orientation in world space, using the shortest arc
+	FQuat DeltaRotation = Newest.Pose.GetRotation() * Reference.Pose.GetRotation().Inverse();
+	DeltaRotation.EnforceShortestArcWith(FQuat::Identity);
+
+	FVector Axis;
+	FQuat::FReal Angle;
+	DeltaRotation.ToAxisAndAngle(Axis, Angle);
+	return Axis * (Angle / DeltaTime);
+}
+
+FTransform UUxtHeadPoseSubsystem::PredictHeadPose(float PredictionTime)
+{
+	const float Time = FMath::Clamp(PredictionTime, 0.0f, MaxPredictionTime);
+	const FTransform HeadPose = GetHeadPose();
+	const FVector LinearVelocity = GetHeadLinearVelocity();
+	const FVector AngularVelocity = GetHeadAngularVelocity();
+
+	FTransform Result = HeadPose;
+	Result.AddToTranslation(LinearVelocity * Time);
+
+	const float AngularSpeed = AngularVelocity.Size();
+	if (AngularSpeed > KINDA_SMALL_NUMBER)
+	{
+		const FQuat DeltaRotation(AngularVelocity / AngularSpeed, AngularSpeed * Time);
+		Result.SetRotation(DeltaRotation * HeadPose.GetRotation());
+	}
+
+	return Result;
+}
+
+void UUxtHeadPoseSubsystem::OnWorldPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaTime)
+{
+	if (InWorld == GetWorld())
+	{
+		UpdateHeadPose();
+	}
+}
+
+void UUxtHeadPoseSubsystem::UpdateHeadPose()
+{
+	if (HistoryHead != INDEX_NONE && LastSampleFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastSampleFrame = GFrameCounter;
+
+	FHeadPoseSample Sample;
+	Sample.Pose = UUxtFunctionLibrary::QueryHeadPose(GetWorld());
+	Sample.Time = GetWorld()->GetRealTimeSeconds();
+
+	if (History.Num() < HistorySize)
+	{
+		HistoryHead = History.Add(Sample);
+	}
+	else
+	{
+		HistoryHead = (HistoryHead + 1) % HistorySize;
+		History[HistoryHead] = Sample;
+	}
+}
+
+const UUxtHeadPoseSubsystem::FHeadPoseSample& UUxtHeadPoseSubsystem::GetSample(int32 Age) const
+{
+	check(Age >= 0 && Age < History.Num());
+	return History[(HistoryHead - Age + History.Num()) % History.Num()];
+}
+
+const UUxtHeadPoseSubsystem::FHeadPoseSample& UUxtHeadPoseSubsystem::GetVelocityReferenceSample() const
+{
+	const double NewestTime = GetSample(0).Time;
+	for (int32 Age = 1; Age < History.Num(); ++Age)
+	{
+		const FHeadPoseSample& Sample = GetSample(Age);
+		if (NewestTime - Sample.Time >= VelocityTimeWindow)
+		{
+			return Sample;
+		}
+	}
+	return GetSample(History.Num() - 1);
+}
@@ -0,0 +1,173 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Utils/UxtParameterCollectionSubsystem.h"
+
+#include "UXTools.h"
+
+#include "Engine/World.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "UObject/ConstructorHelpers.h"
+
+const FVector UUxtParameterCollectionSubsystem::InactivePointerPosition(FLT_MAX);
+
+UUxtParameterCollectionSubsystem::UUxtParameterCollectionSubsystem()
+{
+	static ConstructorHelpers::FObjectFinder<UMaterialParameterCollection> Finder(TEXT("/UXTools/Materials/MPC_UXSettings"));
+	ParameterCollection = Finder.Object;
+}
+
+void UUxtParameterCollectionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (ParameterCollection)
+	{
+		for (const FCollectionVectorParameter& Parameter : ParameterCollection->VectorParameters)
+		{
+			VectorParameters.Add({Parameter.ParameterName, Parameter.DefaultValue, false});
+		}
+
+		for (const FCollectionScalarParameter& Parameter : ParameterCollection->ScalarParameters)
+		{
+			ScalarParameters.Add({Parameter.ParameterName, Parameter.DefaultValue, false});
+		}
+
+		static const FName PointerPositionNames[] = {"LeftPointerPosition", "RightPointerPosition"};
+		for (int32 HandIndex = 0; HandIndex < UE_ARRAY_COUNT(PointerPositionNames); ++HandIndex)
+		{
+			PointerPositionIndices[HandIndex] = FindVectorParameter(PointerPositionNames[HandIndex]);
+			if (PointerPositionIndices[HandIndex] == INDEX_NONE)
+			{
+				UE_LOG(
+					UXTools, Warning, TEXT("Unable to find %s parameter in material parameter collection %s."),
+					*PointerPositionNames[HandIndex].ToString(), *ParameterCollection->GetPathName());
+			}
+		}
+	}
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UUxtParameterCollectionSubsystem::OnWorldPostActorTick);
+}
+
+void UUxtParameterCollectionSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+
+	VectorParameters.Empty();
+	ScalarParameters.Empty();
+	bHasDirtyParameters = false;
+
+	Super::Deinitialize();
+}
+
+int32 UUxtParameterCollectionSubsystem::FindVectorParameter(FName Name) const
+{
+	return VectorParameters.IndexOfByPredicate(
+		[Name](const FBufferedParameter<FLinearColor>& Parameter) { return Parameter.Name == Name; });
+}
+
+int32 UUxtParameterCollectionSubsystem::FindScalarParameter(FName Name) const
+{
+	return ScalarParameters.IndexOfByPredicate([Name](const FBufferedParameter<float>& Parameter) { return Parameter.Name == Name; });
+}
+
+void UUxtParameterCollectionSubsystem::SetVectorParameter(int32 Index, const FLinearColor& Value)
+{
+	FBufferedParameter<FLinearColor>& Parameter = VectorParameters[Index];
+	if (Parameter.Value != Value)
+	{
+		Parameter.Value = Value;
+		Parameter.bIsDirty = true;
+		bHasDirtyParameters = true;
+	}
+}
+
+void UUxtParameterCollectionSubsystem::SetScalarParameter(int32 Index, float Value)
+{
+	FBufferedParameter<float>& Parameter = ScalarParameters[Index];
+	if (Parameter.Value != Value)
+	{
+		Parameter.Value = Value;
+		Parameter.bIsDirty = true;
+		bHasDirtyParameters = true;
+	}
+}
+
+const FLinearColor& UUxtParameterCollectionSubsystem::GetVectorParameter(int32 Index) const
+{
+	return VectorParameters[Index].Value;
+}
+
+float UUxtParameterCollectionSubsystem::GetScalarParameter(int32 Index) const
+{
+	return ScalarParameters[Index].Value;
+}
+
+void UUxtParameterCollectionSubsystem::SetPointerPosition(EControllerHand Hand, const FVector& Position)
+{
+	const int32 Index = PointerPositionIndices[Hand == EControllerHand::Left ? 0 : 1];
+	if (Index != INDEX_NONE)
+	{
+		SetVectorParameter(Index, FLinearColor(Position));
+	}
+}
+
+bool UUxtParameterCollectionSubsystem::GetPointerPosition(EControllerHand Hand, FVector& OutPosition) const
+{
+	const int32 Index = PointerPositionIndices[Hand == EControllerHand::Left ? 0 : 1];
+	if (Index != INDEX_NONE)
+	{
+		OutPosition = FVector(GetVectorParameter(Index));
+		return true;
+	}
+	return false;
+}
+
+void UUxtParameterCollectionSubsystem::CommitParameters()
+{
+	if (!bHasDirtyParameters || !ParameterCollection)
+	{
+		return;
+	}
+
+	UMaterialParameterCollectionInstance* Instance = GetWorld()->GetParameterCollectionInstance(ParameterCollection);
+	if (!Instance)
+	{
+		return;
+	}
+
+	for (FBufferedParameter<FLinearColor>& Parameter : VectorParameters)
+	{
+		if (Parameter.bIsDirty)
+		{
+			Instance->SetVectorParameterValue(Parameter.Name, Parameter.Value);
+			Parameter.bIsDirty = false;
+		}
+	}
+
+	for (FBufferedParameter<float>& Parameter : ScalarParameters)
+	{
+		if (Parameter.bIsDirty)
+		{
+			Instance->SetScalarParameterValue(Parameter.Name, Parameter.Value);
+			Parameter.bIsDirty = false;
+		}
+	}
+
+	bHasDirtyParameters = false;
+}
+
+UMaterialParameterCollection* UUxtParameterCollectionSubsystem::GetParameterCollection() const
+{
+	return ParameterCollection;
+}
+
+void UUxtParameterCollectionSubsystem::OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaTime)
+{
+	if (InWorld == GetWorld())
+	{
+		CommitParameters();
+	}
+}
@@ -171,10 +171,10 @@ private:
 	bool UpdateTrackedHand(FVector& OutPalmLocation, FQuat& OutPalmRotation);
 
 	/**
-	 * Compute hand bounding box from joint transforms and radii.
+	 * Update the hand bounding box in palm space from the joints of the tracked hand.
 	 * Returns true if the hand bounds were successfully updated.
 	 */
-	bool UpdateHandBounds(const FVector& PalmLocation, const FQuat& PalmRotation);
+	bool UpdateHandBounds();
 
 	/**
 	 * Compute goal location and rotation by projecting onto the hand bounds.
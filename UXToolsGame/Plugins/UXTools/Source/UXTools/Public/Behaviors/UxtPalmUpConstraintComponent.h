@@ -7,6 +7,8 @@
 
 #include "UxtPalmUpConstraintComponent.generated.h"
 
+class FUxtHandFrame;
+
 /**
  * Hand constraint component that becomes active if the hand is facing the player camera.
  *
@@ -66,7 +68,7 @@ public:
 
 private:
 	bool IsPalmUp(const FTransform& HeadPose, const FVector& PalmLocation, const FVector& PalmUpVector) const;
-	bool IsHandFlat(EControllerHand NewHand, const FVector& PalmLocation, const FVector& PalmUpVector) const;
+	bool IsHandFlat(const FUxtHandFrame& HandFrame) const;
 	bool HasEyeGaze(EControllerHand NewHand, const FTransform& HeadPose, const FVector& PalmLocation) const;
 
 	/** Cache the gaze trigger so it only needs to be met to activate the constraint. */
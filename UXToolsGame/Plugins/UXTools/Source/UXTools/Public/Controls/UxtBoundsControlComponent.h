@@ -15,7 +15,9 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogUxtBoundsControl, Log, All);
 
 class UUxtBoundsControlComponent;
+class UInstancedStaticMeshComponent;
 class UMaterialInstanceDynamic;
+class UMaterialInterface;
 class UPrimitiveComponent;
 class UStaticMesh;
 class UBoxComponent;
@@ -48,6 +50,22 @@ struct FUxtAffordanceInstance
 
 	/** Reference scale to be used during scaling animations */
 	FVector ReferenceRelativeScale = FVector::OneVector;
+
+	/** Instanced mesh rendering the affordance, only used with instanced affordances. */
+	UPROPERTY()
+	UInstancedStaticMeshComponent* InstancedMesh = nullptr;
+
+	/** Index of the affordance in @ref InstancedMesh. */
+	int32 InstanceIndex = INDEX_NONE;
+
+	/** Current world location of the affordance. */
+	FVector Location = FVector::ZeroVector;
+
+	/** Current world rotation of the affordance. */
+	FQuat Rotation = FQuat::Identity;
+
+	/** Custom data of the instance as last applied: opacity, focus and grab transition. */
+	FVector3f InstanceCustomData = FVector3f::ZeroVector;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
@@ -77,9 +95,12 @@ public:
 	UFUNCTION(BlueprintGetter, Category = "Uxt Bounds Control|Affordances")
 	AActor* GetBoundsControlActor() const;
 
-	/** Get the map between the affordance actors and their information. */
+	/** Get the map between the affordance actors and their information. Empty when using instanced affordances. */
 	const TMap<UPrimitiveComponent*, FUxtAffordanceInstance>& GetPrimitiveAffordanceMap() const;
 
+	/** Get the affordances rendered by instanced meshes, see @ref bUseInstancedAffordances. */
+	const TArray<FUxtAffordanceInstance>& GetInstancedAffordances() const;
+
 	UFUNCTION(BlueprintGetter, Category = "Uxt Bounds Control|Affordances")
 	bool GetInitBoundsFromActor() const;
 
@@ -125,6 +146,23 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Bounds Control", AdvancedDisplay)
 	FName CollisionProfile = TEXT("UI");
 
+	/**
+	 * Render all affordances of the same kind with a single instanced static mesh component, instead of one mesh component and
+	 * dynamic material per affordance. Animation state is passed to the material as per-instance custom data:
+	 * 0 = Opacity, 1 = IsFocused, 2 = IsActive. Requires @ref InstancedAffordanceMaterial.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Uxt Bounds Control|Affordances", AdvancedDisplay)
+	bool bUseInstancedAffordances = false;
+
+	/**
+	 * Material of instanced affordances, which must read the animation state with PerInstanceCustomData nodes.
+	 * The affordance mesh materials read scalar parameters instead, so per-affordance meshes are used if this is not set.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "Uxt Bounds Control|Affordances", AdvancedDisplay,
+		meta = (EditCondition = "bUseInstancedAffordances"))
+	UMaterialInterface* InstancedAffordanceMaterial = nullptr;
+
 	/** Hand distance at which affordances become visible. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Bounds Control")
 	float AffordanceVisibilityDistance = 10.f;
@@ -171,6 +209,12 @@ protected:
 
 	virtual void OnExternalManipulationStarted() override;
 
+	/**
+	 * Look up the affordance at the focus point on the given primitive.
+	 * Returns null if the primitive is not an affordance.
+	 */
+	FUxtAffordanceInstance* FindAffordance(UPrimitiveComponent* Primitive, const FVector& FocusPoint);
+
 	/**
 	 * Look up the grab pointer data for an affordance.
 	 * Returns null if the affordance is not currently grabbed.
@@ -183,6 +227,9 @@ protected:
 	/** Create the BoundsControlActor and all affordances described in the config. */
 	void CreateAffordances();
 
+	/** Create one instanced mesh per affordance kind and add an instance for each affordance. */
+	void CreateInstancedAffordances(USceneComponent* RootComponent);
+
 	/** Destroy the BoundsControlActor and affordance instances. */
 	void DestroyAffordances();
 
@@ -192,6 +239,12 @@ protected:
 	/** Update animated properties such as affordance highlights. */
 	void UpdateAffordanceAnimation(float DeltaTime);
 
+	/** Update the focus count of instanced affordances from the pointers currently focusing them. */
+	void UpdateInstancedAffordanceFocus();
+
+	/** Returns true if affordances are rendered by instanced meshes. */
+	bool HasInstancedAffordances() const { return InstancedAffordances.Num() > 0; }
+
 	/** Returns true if the affordance instance is currently bing grabbed. */
 	bool IsAffordanceGrabbed(const FUxtAffordanceInstance* Affordance) const;
 
@@ -231,10 +284,6 @@ private:
 	UPROPERTY(Transient, Category = "Uxt Bounds Control", BlueprintGetter = "GetBounds")
 	FBox Bounds;
 
-	/** Parameter collection used to store the finger tip position */
-	UPROPERTY(Transient)
-	UMaterialParameterCollection* ParameterCollection;
-
 	/** Actor that contains affordances at runtime. */
 	UPROPERTY(Transient, DuplicateTransient, Category = "Uxt Bounds Control", BlueprintGetter = "GetBoundsControlActor")
 	AActor* BoundsControlActor;
@@ -249,6 +298,27 @@ private:
 	UPROPERTY(Transient)
 	TMap<UPrimitiveComponent*, FUxtAffordanceInstance> PrimitiveAffordanceMap;
 
+	/** Affordances rendered by instanced meshes. Not resized after creation, grabbed affordances point into it. */
+	UPROPERTY(Transient)
+	TArray<FUxtAffordanceInstance> InstancedAffordances;
+
+	/** Instanced mesh of each affordance kind, null for kinds not used by the config. */
+	UPROPERTY(Transient)
+	TArray<UInstancedStaticMeshComponent*> InstancedAffordanceMeshes;
+
+	/**
+	 * Instance transforms of each instanced mesh relative to the mesh, as last applied. Zero scale while hidden.
+	 * Kept between ticks so that unchanged meshes don't need their transforms rebuilt.
+	 */
+	TArray<TArray<FTransform>> InstancedAffordanceTransforms;
+
+	/**
+	 * Pointers focusing instanced affordances.
+	 * Pointers can move between affordances of the same instanced mesh without a focus change, so focus is resolved every tick.
+	 */
+	TArray<TWeakObjectPtr<UUxtNearPointerComponent>> FocusingNearPointers;
+	TArray<TWeakObjectPtr<UUxtFarPointerComponent>> FocusingFarPointers;
+
 	/**
 	 * Contains the currently active affordances being moved by grab pointers.
 	 *
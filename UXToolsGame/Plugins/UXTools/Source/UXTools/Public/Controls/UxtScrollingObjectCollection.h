@@ -70,10 +70,28 @@ struct FScrollingCollectionProperties
 	float Height;
 };
 
+/** Actor of the virtualized item pool and the item it is currently bound to. */
+USTRUCT()
+struct FUxtScrollingCollectionPoolEntry
+{
+	GENERATED_BODY()
+
+	/** Pooled item actor. */
+	UPROPERTY(Transient)
+	AActor* Actor = nullptr;
+
+	/** Index of the item the actor is bound to, INDEX_NONE if the actor is free. */
+	int32 ItemIndex = INDEX_NONE;
+
+	/** Whether the actor is currently shown in the viewable area. */
+	bool bVisible = false;
+};
+
 //
 // Delegates
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FUxtScrollingObjectCollectionUpdated, FScrollingCollectionProperties const&, Properties);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FUxtScrollingObjectCollectionOnPaginationEnd, EUxtPaginateResult, Result);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FUxtScrollingObjectCollectionBindItem, AActor*, ItemActor, int32, ItemIndex);
 
 /**
  * Component that adds a scrollable object menu to the actor to which it is attached
@@ -105,6 +123,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental")
 	void AddActorToCollection(AActor* ActorToAdd);
 
+	/**
+	 * Switch the collection to virtualized mode, where items are provided by a data source instead of attached actors.
+	 * Only actors for the viewable area plus #VirtualizationMargin lines are spawned from the item class. They are recycled
+	 * as the collection scrolls and the bind callback is called whenever an actor is assigned to a different item.
+	 * Actors attached to the collection are hidden while in virtualized mode.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental")
+	void SetVirtualizedDataSource(TSubclassOf<AActor> ItemClass, int32 NumItems, const FUxtScrollingObjectCollectionBindItem& BindItem);
+
+	/**
+	 * Change the number of items of the virtualized data source.
+	 * All visible items are bound again, pooled actors that are no longer needed are destroyed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental")
+	void SetVirtualizedItemCount(int32 NumItems);
+
+	/** Bind all visible items again, e.g. after the data source content has changed. */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental")
+	void RefreshVirtualizedItems();
+
+	/** Returns true if the collection is fed by a virtualized data source. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Scrolling Object Collection - Experimental")
+	bool IsVirtualized() const { return bIsVirtualized; }
+
+	/** Get the actor currently bound to the given item, if any. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Scrolling Object Collection - Experimental")
+	AActor* GetItemActor(int32 ItemIndex) const;
+
 	/** Return current scroll direction */
 	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental", meta = (AutoCreateRefTerm = "Callback"))
 	EUxtScrollDirection GetScrollDirection();
@@ -172,6 +218,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Uxt Scrolling Object Collection - Experimental", meta = (UIMin = "0.0"))
 	float ClickMovementThreshold;
 
+	/** Number of lines bound outside of the viewable area, on each side, in virtualized mode. */
+	UPROPERTY(EditAnywhere, Category = "Uxt Scrolling Object Collection - Experimental", meta = (UIMin = "0"))
+	int32 VirtualizationMargin;
+
 	/** Event raised whenever the collection is updated. */
 	UPROPERTY(BlueprintAssignable, Category = "Uxt Scrolling Object Collection - Experimental")
 	FUxtScrollingObjectCollectionUpdated OnCollectionUpdated;
@@ -184,12 +234,22 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	// Called when the component is registered or unregistered, refreshes the owner in the target registry
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// Called when component is destroyed
 	virtual void DestroyComponent(bool bPromoteToChildred) override;
 
+	// Called when the game ends, pooled item actors are destroyed
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Called when the component has been destroyed, pooled item actors are destroyed
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
 	//
 	// IUxtPokeTarget interface
 	virtual bool IsPokeFocusable_Implementation(const UPrimitiveComponent* Primitive) const override;
@@ -216,8 +276,29 @@ protected:
 	virtual void OnFarReleased_Implementation(UUxtFarPointerComponent* Pointer) override;
 
 private:
-	/** Called to reset the visibility of all attached actors based on current collection state. */
-	void ResetCollectionVisibility();
+	/**
+	 * Called to reset the visibility of all attached actors based on current collection state.
+	 * Actors are only updated when the visible range has changed, unless forced.
+	 */
+	void ResetCollectionVisibility(bool bForce = false);
+
+	/** Bind pooled actors to the items in the given range and update their visibility. */
+	void UpdateVirtualizedItems(int32 FirstVisible, int32 FirstNotVisible);
+
+	/** Unbind all pooled actors so that they are bound again on the next update. */
+	void UnbindVirtualizedItems();
+
+	/** Destroy all pooled actors. */
+	void DestroyVirtualizedItems();
+
+	/** Returns true if the actor belongs to the virtualized item pool. */
+	bool IsVirtualizedItemActor(const AActor* Actor) const;
+
+	/** Get the number of items in the collection, either attached actors or data source items. */
+	int32 GetNumItems() const;
+
+	/** Get the location of an item relative to the collection root. */
+	FVector GetItemRelativeLocation(int32 ItemIndex) const;
 
 	/** Called to update the collection based on the current properties. */
 	void InitializeCollection();
@@ -333,6 +414,30 @@ private:
 	/** Pagination complete delegate. */
 	FUxtScrollingObjectCollectionOnPaginationEnd OnPaginationComplete;
 
+	/** Range of items that were visible in the last visibility update, as first visible and first not visible. */
+	FIntPoint VisibleItemRange;
+
+	/** True if items are provided by a data source instead of attached actors. */
+	bool bIsVirtualized;
+
+	/** Number of items of the virtualized data source. */
+	int32 VirtualizedItemCount;
+
+	/** Actor class spawned for virtualized items. */
+	UPROPERTY(Transient)
+	TSubclassOf<AActor> VirtualizedItemClass;
+
+	/** Callback binding a pooled actor to a virtualized item. */
+	FUxtScrollingObjectCollectionBindItem BindVirtualizedItem;
+
+	/** Pooled actors for virtualized items. */
+	UPROPERTY(Transient)
+	TArray<FUxtScrollingCollectionPoolEntry> VirtualizedItemPool;
+
+	/** Pooled actors indexed by the item they are bound to. */
+	UPROPERTY(Transient)
+	TMap<int32, AActor*> VirtualizedItemActors;
+
 	/** Has hit the #ClickMovementThreshold */
 	bool bHasHitClickMovementThreshold;
 
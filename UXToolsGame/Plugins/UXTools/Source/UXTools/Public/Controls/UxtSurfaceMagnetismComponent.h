@@ -62,6 +62,8 @@ protected:
 	// UActorComponent interface
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 	//
 	// IUxtFarTarget interface
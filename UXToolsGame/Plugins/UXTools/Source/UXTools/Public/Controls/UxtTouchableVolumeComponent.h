@@ -111,6 +111,8 @@ protected:
 	//
 	// UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 	//
 	// IUxtPokeTarget interface
@@ -38,6 +38,8 @@ protected:
 	//
 	// UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 	//
 	// IUxtPokeTarget interface
@@ -7,11 +7,18 @@
 #include "HeadMountedDisplayTypes.h"
 #include "IMotionController.h"
 
+#include "HandTracking/UxtHandFrame.h"
+#include "HandTracking/UxtHandJointFilter.h"
+#include "HandTracking/UxtHandPosePredictor.h"
+
 /**
  * Hand tracker device interface.
  * We assume that implementations poll and cache the hand tracking state at the beginning of the frame.
  * This allows us to assume that if a hand is reported as tracked it will remain so for the remainder of the frame,
  * simplifying client logic.
+ *
+ * Trackers may filter the joints they report, see SetJointFilterSettings. The unfiltered joints remain available from the raw accessors.
+ * The interface holds no state, hand frames and histories are kept by the implementations.
  */
 class UXTOOLS_API IUxtHandTracker : public IModularFeature
 {
@@ -35,6 +42,37 @@ public:
 	virtual bool GetJointState(
 		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const = 0;
 
+	/** Obtain the state of all joints of the hand in a single call.
+	 * Output arrays are indexed by EHandKeypoint and must have EHandKeypointCount elements.
+	 * Returns false if the hand is not tracked this frame, in which case the values of the output arrays are unchanged.
+	 * The default implementation calls GetJointState for each joint, trackers should override it with a bulk copy.
+	 */
+	virtual bool GetAllJointStates(
+		EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions, TArrayView<float> OutRadii) const;
+
+	/** Obtain the unfiltered state of the given joint.
+	 * Returns false if the hand is not tracked this frame, in which case the values of the output parameters are unchanged.
+	 * The default implementation returns the same state as GetJointState, for trackers that don't filter joints.
+	 */
+	virtual bool GetRawJointState(
+		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const;
+
+	/** Obtain the unfiltered state of all joints of the hand in a single call.
+	 * Output arrays are indexed by EHandKeypoint and must have EHandKeypointCount elements.
+	 * Returns false if the hand is not tracked this frame, in which case the values of the output arrays are unchanged.
+	 * The default implementation returns the same state as GetAllJointStates, for trackers that don't filter joints.
+	 */
+	virtual bool GetAllRawJointStates(
+		EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions, TArrayView<float> OutRadii) const;
+
+	/** Configure the filtering of the joints reported by GetJointState and GetAllJointStates.
+	 * Pointer and grip poses are reported unfiltered. Trackers without a filtering stage ignore the settings.
+	 */
+	virtual void SetJointFilterSettings(const FUxtHandJointFilterSettings& Settings) {}
+
+	/** Get the settings of the joint filter, filtering is disabled for trackers without a filtering stage. */
+	virtual const FUxtHandJointFilterSettings& GetJointFilterSettings() const;
+
 	/** Obtain the pointer pose.
 	 * Returns false if the hand is not tracked this frame, in which case the value of the output parameter is unchanged.
 	 */
@@ -52,4 +90,39 @@ public:
 	/** Obtain current selection state.
 	 * Returns false if the hand is not tracked this frame, in which case the value of the output parameter is unchanged. */
 	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const = 0;
+
+	/** Get a snapshot of the hand in the current frame.
+	 * The snapshot is captured on first access in each frame and shared by all callers, along with the values derived from it.
+	 * The returned reference remains valid until the tracker is destroyed, but its content is only up to date within the current frame.
+	 * Trackers can implement this with an FUxtHandFrameCache.
+	 */
+	virtual const FUxtHandFrame& GetHandFrame(EControllerHand Hand) const = 0;
+
+	/** Get the recent history of the hand, up to and including the snapshot of the current frame.
+	 * Samples are timestamped with FApp::GetCurrentTime and the history is maintained whether or not prediction is enabled.
+	 * Only the left and right hands have a history, the history of other hands is always empty.
+	 * The default implementation returns an empty history, for trackers that don't keep one.
+	 */
+	virtual const FUxtHandHistory& GetHandHistory(EControllerHand Hand) const;
+
+	/** Configure the prediction of hand poses. Trackers without prediction ignore the settings. */
+	virtual void SetPredictionSettings(const FUxtHandPredictionSettings& Settings) {}
+
+	/** Get the settings of hand pose prediction, prediction is always disabled for trackers without prediction. */
+	virtual const FUxtHandPredictionSettings& GetPredictionSettings() const;
+
+	/** Obtain the state of the given joint extrapolated to the target time, e.g. the predicted display time of the frame.
+	 * Times are in seconds on the FApp::GetCurrentTime clock, hands are sampled at the current time of each frame.
+	 * Returns the current state if prediction is disabled or the hand has not been tracked long enough to estimate its motion.
+	 * Returns false if the hand is not tracked this frame, in which case the values of the output parameters are unchanged.
+	 * The default implementation returns the current state, for trackers without prediction.
+	 */
+	virtual bool GetPredictedJointState(
+		EControllerHand Hand, EHandKeypoint Joint, double TargetTime, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const;
+
+	/** Obtain the pointer pose extrapolated to the target time, see GetPredictedJointState. */
+	virtual bool GetPredictedPointerPose(EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const;
+
+	/** Obtain the grip pose extrapolated to the target time, see GetPredictedJointState. */
+	virtual bool GetPredictedGripPose(EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const;
 };
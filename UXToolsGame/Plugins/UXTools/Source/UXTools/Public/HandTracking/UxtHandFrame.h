@@ -0,0 +1,120 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HeadMountedDisplayTypes.h"
+#include "InputCoreTypes.h"
+
+class IUxtHandTracker;
+
+/**
+ * Snapshot of the state of a hand in a single frame.
+ *
+ * Captures the joints, pointer and grip poses of a hand once and derives commonly used quantities from them on first use,
+ * so that pointers, constraints and other hand consumers share the work instead of querying the tracker and redoing the same math.
+ * Frames are obtained from IUxtHandTracker::GetHandFrame and must only be used on the game thread within the frame they are obtained.
+ *
+ * Grab and select states are not captured as they are driven by input events which may arrive in the middle of a frame.
+ */
+class UXTOOLS_API FUxtHandFrame
+{
+public:
+	/** Capture the state of the hand from the tracker, discarding all derived values. */
+	void Capture(const IUxtHandTracker& HandTracker, EControllerHand InHand);
+
+	/** Hand the frame has been captured for. */
+	EControllerHand GetHand() const { return Hand; }
+
+	/** Tracking status of the hand or motion controller. */
+	ETrackingStatus GetTrackingStatus() const { return TrackingStatus; }
+
+	/** True if the joints of the hand are available in this frame. Joint accessors and joint based values are only valid if true. */
+	bool HasJoints() const { return bHasJoints; }
+
+	const FQuat& GetJointOrientation(EHandKeypoint Joint) const { return JointOrientations[(int32)Joint]; }
+	const FVector& GetJointPosition(EHandKeypoint Joint) const { return JointPositions[(int32)Joint]; }
+	float GetJointRadius(EHandKeypoint Joint) const { return JointRadii[(int32)Joint]; }
+	FTransform GetJointTransform(EHandKeypoint Joint) const { return FTransform(GetJointOrientation(Joint), GetJointPosition(Joint)); }
+
+	/** True if the pointer pose is available in this frame. */
+	bool HasPointerPose() const { return bHasPointerPose; }
+
+	/** Pointer pose of the hand, identity if not available. */
+	const FTransform& GetPointerTransform() const { return PointerTransform; }
+
+	/** True if the grip pose is available in this frame. */
+	bool HasGripPose() const { return bHasGripPose; }
+
+	/** Grip pose following the controller, identity if not available. */
+	const FTransform& GetGripTransform() const { return GripTransform; }
+
+	//
+	// Derived values, computed on first use. Joint based values have their default if the joints are not available.
+
+	/** Transform midway between the index and thumb tips, used by near pointers for grabbing. */
+	const FTransform& GetGrabPointerTransform() const;
+
+	/** Distance between the index and thumb tips. */
+	float GetPinchDistance() const;
+
+	/** Plane through the wrist and the index and little metacarpals. */
+	const FPlane& GetPalmPlane() const;
+
+	/** Up vector of the palm joint. Note that it is normal to the back of the hand, not the inside. */
+	FVector GetPalmUpVector() const { return GetJointOrientation(EHandKeypoint::Palm).GetUpVector(); }
+
+	/**
+	 * Normal of the triangle between the palm and the index and ring tips.
+	 * Faces the same way as the palm up vector when the hand is flat, the angle between both is a measure of hand flatness.
+	 */
+	const FVector& GetFingerPlaneNormal() const;
+
+	/** Bounding box of all joints including their radii, in the space of the palm joint. */
+	const FBox& GetBounds() const;
+
+	/**
+	 * True if the inside of the palm faces away from the viewer and does not face upward, i.e. the hand is pointing at something.
+	 * Always true if the joints are not available, e.g. for motion controllers.
+	 */
+	bool IsInPointingPose(const FVector& ViewForward) const;
+
+	/** Maximum alignment of the inside of the palm with the view backward direction for the pointing pose. */
+	static constexpr float PointingPoseBackwardTolerance = 0.5f;
+
+	/** Maximum alignment of the inside of the palm with the world up direction for the pointing pose. */
+	static constexpr float PointingPoseUpwardTolerance = 0.8f;
+
+private:
+	/** Flags of the derived values computed since the last capture. */
+	enum class EDerivedValue : uint8
+	{
+		GrabPointerTransform = 1 << 0,
+		PalmPlane = 1 << 1,
+		FingerPlaneNormal = 1 << 2,
+		Bounds = 1 << 3,
+	};
+
+	/** Returns true if the value needs to be computed, marking it as computed. */
+	bool ComputeOnce(EDerivedValue Value) const;
+
+	EControllerHand Hand = EControllerHand::AnyHand;
+	ETrackingStatus TrackingStatus = ETrackingStatus::NotTracked;
+	bool bHasJoints = false;
+	bool bHasPointerPose = false;
+	bool bHasGripPose = false;
+
+	FQuat JointOrientations[EHandKeypointCount];
+	FVector JointPositions[EHandKeypointCount];
+	float JointRadii[EHandKeypointCount];
+
+	FTransform PointerTransform = FTransform::Identity;
+	FTransform GripTransform = FTransform::Identity;
+
+	mutable uint8 ComputedValues = 0;
+	mutable FTransform GrabPointerTransform = FTransform::Identity;
+	mutable FPlane PalmPlane = FPlane(ForceInit);
+	mutable FVector FingerPlaneNormal = FVector::ZeroVector;
+	mutable FBox Bounds = FBox(ForceInit);
+};
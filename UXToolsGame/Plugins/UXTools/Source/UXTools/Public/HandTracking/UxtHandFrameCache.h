@@ -0,0 +1,77 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HeadMountedDisplayTypes.h"
+#include "InputCoreTypes.h"
+
+#include "HandTracking/UxtHandFrame.h"
+#include "HandTracking/UxtHandHistory.h"
+#include "HandTracking/UxtHandPosePredictor.h"
+
+class IUxtHandTracker;
+
+/**
+ * Hand frames, hand histories and pose prediction of a hand tracker.
+ *
+ * Owned by hand tracker implementations to back the frame, history and prediction accessors of IUxtHandTracker.
+ * Frames are captured from the tracker on first access in each frame, or all at once by Update.
+ * Like the frames it holds, the cache must only be used on the game thread.
+ */
+class UXTOOLS_API FUxtHandFrameCache
+{
+public:
+	/** Histories are kept for the left and right hands, unless disabled for trackers that can't provide motion. */
+	explicit FUxtHandFrameCache(bool bKeepHistories = true);
+
+	/** Get the frame of the hand captured from the tracker in the current frame, see IUxtHandTracker::GetHandFrame. */
+	const FUxtHandFrame& GetHandFrame(const IUxtHandTracker& HandTracker, EControllerHand Hand);
+
+	/** Get the history of the hand up to the current frame, see IUxtHandTracker::GetHandHistory. */
+	const FUxtHandHistory& GetHandHistory(const IUxtHandTracker& HandTracker, EControllerHand Hand);
+
+	/** Configure the prediction of hand poses. */
+	void SetPredictionSettings(const FUxtHandPredictionSettings& Settings) { PredictionSettings = Settings; }
+
+	/** Get the settings of hand pose prediction. */
+	const FUxtHandPredictionSettings& GetPredictionSettings() const { return PredictionSettings; }
+
+	/** Obtain the state of the given joint extrapolated to the target time, see IUxtHandTracker::GetPredictedJointState. */
+	bool GetPredictedJointState(
+		const IUxtHandTracker& HandTracker, EControllerHand Hand, EHandKeypoint Joint, double TargetTime, FQuat& OutOrientation,
+		FVector& OutPosition, float& OutRadius);
+
+	/** Obtain the pointer pose extrapolated to the target time, see IUxtHandTracker::GetPredictedJointState. */
+	bool GetPredictedPointerPose(
+		const IUxtHandTracker& HandTracker, EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition);
+
+	/** Obtain the grip pose extrapolated to the target time, see IUxtHandTracker::GetPredictedJointState. */
+	bool GetPredictedGripPose(
+		const IUxtHandTracker& HandTracker, EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition);
+
+	/** Capture the left and right hand frames immediately, trackers can call this after caching the tracking state of a frame. */
+	void Update(const IUxtHandTracker& HandTracker);
+
+	/** Recapture the hand frames on next access, trackers must call this when the tracking state changes within a frame. */
+	void Invalidate();
+
+	/** Discard the hand histories and recapture the hand frames on next access, e.g. when the tracker is reset. */
+	void Reset();
+
+private:
+	/** Capture the hand frame at the index and add it to the hand history. */
+	void CaptureHandFrame(const IUxtHandTracker& HandTracker, int32 Index, EControllerHand Hand);
+
+	/** Hand frames of the left and right hand, followed by a slot shared by other hands. */
+	FUxtHandFrame HandFrames[3];
+
+	/** Frame counter at which the hand frames have been captured. */
+	uint64 HandFramesCounter[3] = {MAX_uint64, MAX_uint64, MAX_uint64};
+
+	/** Histories of the left and right hand frames, used for velocities and prediction. Empty if histories are disabled. */
+	TArray<FUxtHandHistory> HandHistories;
+
+	FUxtHandPredictionSettings PredictionSettings;
+};
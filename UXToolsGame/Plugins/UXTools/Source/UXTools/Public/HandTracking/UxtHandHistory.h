@@ -0,0 +1,110 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HandTracking/UxtHandFrame.h"
+
+/** Pose of a hand that can be looked up in the hand history. */
+enum class EUxtHandHistoryPose : uint8
+{
+	/** Pose of a joint. */
+	Joint,
+	/** Pointer pose. */
+	Pointer,
+	/** Grip pose. */
+	Grip,
+};
+
+/**
+ * Poses of a hand sampled at a time in seconds.
+ * Only the poses used for velocities and prediction are kept, in single precision to keep the history compact.
+ */
+struct UXTOOLS_API FUxtHandHistorySample
+{
+	/** Copy the poses available in the hand frame. */
+	void SetPoses(const FUxtHandFrame& HandFrame);
+
+	/** True if the pose is available in the sample. */
+	bool HasPose(EUxtHandHistoryPose Pose) const;
+
+	/** Get a pose of the sample. Only valid if the pose is available. */
+	FTransform GetPose(EUxtHandHistoryPose Pose, EHandKeypoint Joint = EHandKeypoint::Palm) const;
+
+	double Time = 0.0;
+
+	bool bHasJoints = false;
+	bool bHasPointerPose = false;
+	bool bHasGripPose = false;
+
+	FQuat4f JointOrientations[EHandKeypointCount];
+	FVector3f JointPositions[EHandKeypointCount];
+
+	FQuat4f PointerOrientation;
+	FVector3f PointerPosition;
+
+	FQuat4f GripOrientation;
+	FVector3f GripPosition;
+};
+
+/**
+ * Fixed capacity history of the recent poses of a hand.
+ *
+ * Samples are stored in place in a ring buffer, adding samples never allocates. The history restarts when the hand,
+ * pointer or grip pose is lost or found, so all samples in the history have the same poses available.
+ * Poses can be looked up by sample age or interpolated at a given time, and velocities estimated over any window within the history.
+ */
+class UXTOOLS_API FUxtHandHistory
+{
+public:
+	/** Discard all samples. */
+	void Reset();
+
+	/** Add the poses of a hand frame sampled at the given time in seconds. A sample at the time of the latest sample replaces it. */
+	void AddSample(double Time, const FUxtHandFrame& HandFrame);
+
+	/** Number of samples in the history. */
+	int32 Num() const { return NumSamples; }
+
+	/** Get a sample by age, 0 being the most recent one. */
+	const FUxtHandHistorySample& GetSample(int32 Age) const;
+
+	/** True if the pose is available in the samples of the history. */
+	bool HasPose(EUxtHandHistoryPose Pose) const;
+
+	/**
+	 * Get the pose at the given time, interpolated between the samples around it.
+	 * Returns false if the time is outside of the history or the pose is not available.
+	 */
+	bool GetPoseAtTime(EUxtHandHistoryPose Pose, double Time, FTransform& OutPose, EHandKeypoint Joint = EHandKeypoint::Palm) const;
+
+	/**
+	 * Estimate the linear velocity of the pose in cm/s over the given time window ending at the most recent sample.
+	 * The window is clamped to the time span of the history. Returns false if the history does not span any time.
+	 */
+	bool GetLinearVelocity(
+		EUxtHandHistoryPose Pose, float Window, FVector& OutVelocity, EHandKeypoint Joint = EHandKeypoint::Palm) const;
+
+	/**
+	 * Estimate the angular velocity of the pose over the given time window ending at the most recent sample,
+	 * as rotation axis in world space scaled by radians per second. See GetLinearVelocity.
+	 */
+	bool GetAngularVelocity(
+		EUxtHandHistoryPose Pose, float Window, FVector& OutAngularVelocity, EHandKeypoint Joint = EHandKeypoint::Palm) const;
+
+	/** Maximum number of samples in the history. */
+	static constexpr int32 Capacity = 32;
+
+private:
+	/** Get the most recent pose and the pose at the start of the window, returns false if they are not available. */
+	bool GetWindowPoses(
+		EUxtHandHistoryPose Pose, float Window, EHandKeypoint Joint, FTransform& OutStartPose, FTransform& OutEndPose,
+		double& OutDuration) const;
+
+	/** Ring buffer of samples, Head is the index of the most recent one. */
+	FUxtHandHistorySample Samples[Capacity];
+	int32 Head = 0;
+	int32 NumSamples = 0;
+};
@@ -0,0 +1,110 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HeadMountedDisplayTypes.h"
+
+#include "UxtHandJointFilter.generated.h"
+
+/**
+ * Parameters of a One Euro filter.
+ * The cutoff frequency of the filter adapts to the speed of the signal: slow movement is smoothed to remove jitter,
+ * fast movement is followed closely to reduce lag.
+ */
+USTRUCT(BlueprintType)
+struct UXTOOLS_API FUxtOneEuroFilterSettings
+{
+	GENERATED_BODY()
+
+	FUxtOneEuroFilterSettings() = default;
+
+	FUxtOneEuroFilterSettings(float InMinCutoff, float InBeta, float InDerivativeCutoff)
+		: MinCutoff(InMinCutoff), Beta(InBeta), DerivativeCutoff(InDerivativeCutoff)
+	{
+	}
+
+	/** Cutoff frequency in Hz when the joint does not move. Lower values remove more jitter at low speeds. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (ClampMin = "0.01"))
+	float MinCutoff = 1.0f;
+
+	/**
+	 * Increase of the cutoff frequency in Hz per unit of speed, in cm/s for positions and degrees/s for orientations.
+	 * Higher values reduce lag during fast movement.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (ClampMin = "0.0"))
+	float Beta = 0.1f;
+
+	/** Cutoff frequency in Hz of the speed estimate. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter", meta = (ClampMin = "0.01"))
+	float DerivativeCutoff = 1.0f;
+};
+
+/** Settings of the joint filtering stage of hand trackers. */
+USTRUCT(BlueprintType)
+struct UXTOOLS_API FUxtHandJointFilterSettings
+{
+	GENERATED_BODY()
+
+	/** Filter the joints of tracked hands. Raw joints remain available from the hand tracker either way. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+	bool bEnabled = false;
+
+	/** Filter parameters of the wrist, palm and metacarpal joints. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+	FUxtOneEuroFilterSettings Palm;
+
+	/** Filter parameters of the proximal, intermediate and distal finger joints. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+	FUxtOneEuroFilterSettings Fingers;
+
+	/** Filter parameters of the finger tips. Tips drive poking and pinching, so they are kept more responsive by default. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+	FUxtOneEuroFilterSettings FingerTips = FUxtOneEuroFilterSettings(2.0f, 0.2f, 1.0f);
+};
+
+/**
+ * One Euro filter over all joints of a hand.
+ *
+ * Positions are filtered in a single pass over the flat array of joint coordinates, with the per-joint filter coefficients
+ * expanded to each coordinate up front, so that the inner loops carry no branches or joint lookups and vectorize well.
+ * Orientations are filtered per joint by interpolating towards the new orientation, with the cutoff driven by the angular speed.
+ * Radii are not filtered.
+ */
+class UXTOOLS_API FUxtHandJointFilter
+{
+public:
+	/** Discard the filter state, the next update passes the joints through unchanged. */
+	void Reset();
+
+	/** True if the filter has been updated since the last reset. */
+	bool HasState() const { return bHasState; }
+
+	/** Filter the new joints of the hand, indexed by EHandKeypoint. */
+	void Update(const FQuat* Orientations, const FVector* Positions, float DeltaTime, const FUxtHandJointFilterSettings& Settings);
+
+	/** Filtered joint orientations, indexed by EHandKeypoint. Only valid if HasState. */
+	const FQuat* GetOrientations() const { return Orientations; }
+
+	/** Filtered joint positions, indexed by EHandKeypoint. Only valid if HasState. */
+	const FVector* GetPositions() const { return Positions; }
+
+	/** Get the filter parameters used for the joint. */
+	static const FUxtOneEuroFilterSettings& GetJointSettings(const FUxtHandJointFilterSettings& Settings, EHandKeypoint Joint);
+
+private:
+	/** Number of filtered position coordinates. */
+	static constexpr int32 NumCoordinates = EHandKeypointCount * 3;
+
+	bool bHasState = false;
+
+	FQuat Orientations[EHandKeypointCount];
+	FVector Positions[EHandKeypointCount];
+
+	/** Filtered speed of the joint positions, per coordinate. */
+	FVector PositionDerivatives[EHandKeypointCount];
+
+	/** Filtered angular speed of the joint orientations in degrees/s. */
+	float AngularSpeeds[EHandKeypointCount];
+};
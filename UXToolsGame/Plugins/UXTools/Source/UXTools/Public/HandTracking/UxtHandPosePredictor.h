@@ -0,0 +1,60 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HandTracking/UxtHandHistory.h"
+
+#include "UxtHandPosePredictor.generated.h"
+
+/** Settings of hand pose prediction. */
+USTRUCT(BlueprintType)
+struct UXTOOLS_API FUxtHandPredictionSettings
+{
+	GENERATED_BODY()
+
+	/** Extrapolate poses from the recent motion of the hands. Predicted poses equal the current poses if disabled. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction")
+	bool bEnabled = false;
+
+	/** Maximum time in seconds that poses are extrapolated beyond the latest sample. Larger horizons overshoot on sudden stops. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prediction", meta = (ClampMin = "0.0", UIMax = "0.1"))
+	float MaxPredictionTime = 0.05f;
+};
+
+/**
+ * Extrapolates the poses of a hand from its recent history.
+ *
+ * Linear and angular velocities are estimated over a short window rather than the last frame, which smooths out tracking noise.
+ * Nothing is predicted across tracking loss, since the history restarts when the hand, pointer or grip pose is lost or found.
+ */
+class UXTOOLS_API FUxtHandPosePredictor
+{
+public:
+	explicit FUxtHandPosePredictor(const FUxtHandHistory& InHistory) : History(InHistory) {}
+
+	/**
+	 * Extrapolate the joint to the target time, clamped to MaxPredictionTime after the latest sample.
+	 * Returns false if the joints of the latest sample are not available.
+	 */
+	bool PredictJoint(EHandKeypoint Joint, double TargetTime, float MaxPredictionTime, FQuat& OutOrientation, FVector& OutPosition) const;
+
+	/** Extrapolate the pointer pose to the target time. Returns false if the latest sample has no pointer pose. */
+	bool PredictPointerPose(double TargetTime, float MaxPredictionTime, FQuat& OutOrientation, FVector& OutPosition) const;
+
+	/** Extrapolate the grip pose to the target time. Returns false if the latest sample has no grip pose. */
+	bool PredictGripPose(double TargetTime, float MaxPredictionTime, FQuat& OutOrientation, FVector& OutPosition) const;
+
+	/** Time window in seconds over which velocities are estimated. */
+	static constexpr float VelocityWindow = 0.05f;
+
+private:
+	/** Extrapolate the latest pose with the velocities over the velocity window. */
+	bool Predict(
+		EUxtHandHistoryPose Pose, EHandKeypoint Joint, double TargetTime, float MaxPredictionTime, FQuat& OutOrientation,
+		FVector& OutPosition) const;
+
+	const FUxtHandHistory& History;
+};
@@ -0,0 +1,57 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Components/ActorComponent.h"
+#include "HandTracking/UxtHandRecording.h"
+
+#include "UxtHandRecorderComponent.generated.h"
+
+/**
+ * Component that captures the state of both hands from the current hand tracker once per frame while recording.
+ * Recordings can be saved to a binary file and played back deterministically, e.g. in automation tests and benchmarks.
+ */
+UCLASS(ClassGroup = "UXTools", meta = (BlueprintSpawnableComponent))
+class UXTOOLS_API UUxtHandRecorderComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UUxtHandRecorderComponent();
+
+	/** Discard any recorded frames and start recording. */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Hand Recorder")
+	void StartRecording();
+
+	/** Stop recording. Recorded frames are kept until recording is started again. */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Hand Recorder")
+	void StopRecording();
+
+	/** Write the recorded frames to a binary file. Returns false if the file could not be written. */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Hand Recorder")
+	bool SaveRecording(const FString& Filename);
+
+	UFUNCTION(BlueprintPure, Category = "Uxt Hand Recorder")
+	bool IsRecording() const { return bIsRecording; }
+
+	/** Number of frames recorded so far. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Hand Recorder")
+	int32 GetNumRecordedFrames() const { return Recording.Frames.Num(); }
+
+	/** Get the recorded frames. */
+	const FUxtHandRecording& GetRecording() const { return Recording; }
+
+protected:
+	//
+	// UActorComponent interface
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	FUxtHandRecording Recording;
+
+	bool bIsRecording = false;
+};
@@ -0,0 +1,84 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HeadMountedDisplayTypes.h"
+#include "InputCoreTypes.h"
+
+class IUxtHandTracker;
+
+/**
+ * State of a single hand in a recorded frame, as reported by the hand tracker interface.
+ * Joints, pointer pose and grip pose are recorded separately since a tracked device does not have to provide all of them,
+ * e.g. motion controllers have poses but no joints. Values are stored in single precision to keep recordings compact.
+ */
+struct UXTOOLS_API FUxtRecordedHandState
+{
+	FUxtRecordedHandState();
+
+	/** Capture the current state of the hand from the given hand tracker. */
+	void Capture(const IUxtHandTracker& HandTracker, EControllerHand Hand);
+
+	/** Serialize the hand state. Joints and poses are only stored if they were available when captured. */
+	friend UXTOOLS_API FArchive& operator<<(FArchive& Ar, FUxtRecordedHandState& State);
+
+	bool bIsTracked = false;
+	bool bIsHandController = false;
+	bool bIsGrabbing = false;
+	bool bIsSelectPressed = false;
+
+	/** Joints are only valid if the hand tracker reported them. */
+	bool bHasJoints = false;
+
+	/** Pointer pose is only valid if the hand tracker reported it. */
+	bool bHasPointerPose = false;
+
+	/** Grip pose is only valid if the hand tracker reported it. */
+	bool bHasGripPose = false;
+
+	FQuat4f JointOrientations[EHandKeypointCount];
+	FVector3f JointPositions[EHandKeypointCount];
+	float JointRadii[EHandKeypointCount];
+
+	FQuat4f PointerOrientation;
+	FVector3f PointerPosition;
+
+	FQuat4f GripOrientation;
+	FVector3f GripPosition;
+};
+
+/** Hand tracker state of both hands in a single frame. */
+struct UXTOOLS_API FUxtRecordedFrame
+{
+	/** Get the state of the given hand. */
+	const FUxtRecordedHandState& GetHandState(EControllerHand Hand) const;
+
+	friend UXTOOLS_API FArchive& operator<<(FArchive& Ar, FUxtRecordedFrame& Frame);
+
+	/** Time elapsed since the previous frame when recorded. */
+	float DeltaTime = 0.0f;
+
+	FUxtRecordedHandState LeftHand;
+	FUxtRecordedHandState RightHand;
+};
+
+/**
+ * Sequence of hand tracker states recorded frame by frame, see UUxtHandRecorderComponent.
+ * Recordings are stored in a compact binary format that can be played back deterministically in tests.
+ */
+struct UXTOOLS_API FUxtHandRecording
+{
+	/** Serialize the recording, including the file header. Sets the archive error flag if the header is not valid. */
+	void Serialize(FArchive& Ar);
+
+	/** Write the recording to a binary file. Returns false if the file could not be written. */
+	bool SaveToFile(const FString& Filename);
+
+	/** Read the recording from a binary file. Returns false if the file could not be read or is not a valid recording. */
+	bool LoadFromFile(const FString& Filename);
+
+	/** Recorded frames in order. */
+	TArray<FUxtRecordedFrame> Frames;
+};
@@ -9,7 +9,8 @@
 #include "UxtPointerComponent.h"
 
 #include "Components/ActorComponent.h"
-#include "Materials/MaterialParameterCollection.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
+#include "WorldCollision.h"
 
 #include "UxtFarPointerComponent.generated.h"
 
@@ -68,6 +69,8 @@ public:
 	//
 	// UActorComponent interface
 
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void SetActive(bool bNewActive, bool bReset = false) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -82,6 +85,48 @@ private:
 	/** Called every tick to update the pointer pose with the latest information from the hand tracker. */
 	void OnPointerPoseUpdated(const FQuat& NewOrientation, const FVector& NewOrigin);
 
+	/** Calculate the ray used for querying the scene from the given pointer pose. */
+	void CalcRay(const FQuat& Orientation, const FVector& Origin, FVector& OutStart, FVector& OutEnd) const;
+
+	/**
+	 * Get the ray to be traced by the far pointer query subsystem in this frame from the latest hand tracker pose.
+	 * Returns false if the pointer is not going to trace the scene this frame or traces it by itself.
+	 */
+	bool GetBatchedRay(FVector& OutStart, FVector& OutEnd) const;
+
+	/** Find the first primitive blocking the ray, reusing the candidates of the last scene query if possible. */
+	bool TraceRay(const FVector& Start, const FVector& End, FHitResult& OutHit);
+
+	/**
+	 * Select the far target within the cone around the ray with the best score, given the hit of the line trace along the ray.
+	 * Replaces the hit if a far target other than the hit primitive is selected.
+	 */
+	void ConeCast(const FVector& Start, const FVector& End, FHitResult& InOutHit);
+
+	/**
+	 * Keep the focused far target if the hit has moved to another far target within the focus switch margin or dwell time.
+	 * Replaces the hit with a hit on the focused primitive in that case.
+	 */
+	void ApplyFocusHysteresis(const FVector& Start, const FVector& End, FHitResult& InOutHit);
+
+	/** Make a hit on the primitive at the given point near the ray, with the normal facing the ray. */
+	static FHitResult MakeClosestPointHit(UPrimitiveComponent* Primitive, const FVector& Start, const FVector& End, const FVector& Point);
+
+	/** Make a capsule enclosing all points within the margin of the ray. */
+	static FCollisionShape MakeRayCapsule(const FVector& Start, const FVector& End, float Margin, FVector& OutCenter, FQuat& OutRotation);
+
+	/** Store the primitives blocking the trace channel among the overlaps as ray candidates. */
+	void SetRayCandidates(const TArray<FOverlapResult>& Overlaps);
+
+	/** Request an expanded scene query around the given ray, to be consumed in the next frame. */
+	void RequestAsyncRayQuery(const FVector& Start, const FVector& End);
+
+	/** Store the results of the asynchronous query requested in the previous frame as ray candidates, if available. */
+	void ConsumeAsyncRayQuery();
+
+	/** Whether the candidates of the last expanded query contain all primitives that can block the given ray. */
+	bool CanReuseRayCandidates(const FVector& Start, const FVector& End) const;
+
 	/** Called every tick to update the pressed state with the latest information from the hand tracker. */
 	void SetPressed(bool bNewPressed);
 
@@ -108,6 +153,75 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer")
 	float RayLength = 500;
 
+	/**
+	 * Trace the ray together with the rays of all other far pointers in the world, see UUxtFarPointerQuerySubsystem.
+	 * Rays are traced in parallel when the first far pointer ticks in a frame. Does not apply when reusing or running asynchronous
+	 * ray queries.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay)
+	bool bUseBatchedRayQuery = false;
+
+	/**
+	 * Reuse the primitives around the ray found by the last scene query while the ray start and end move less than RayQueryMargin.
+	 * The scene query is expanded by the margin and on the following frames the ray is only traced against the cached candidates,
+	 * which is cheaper than a scene query while the hand is held nearly still.
+	 * Primitives moving into the ray on their own are only found by the next full query, see MaxRayQueryInterval.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay)
+	bool bReuseRayQuery = false;
+
+	/**
+	 * Run the scene query around the ray asynchronously and use its results in the next frame, moving it off the game thread.
+	 * The results are only used if the ray start and end have moved less than RayQueryMargin since the query was requested,
+	 * otherwise the pointer falls back to a synchronous query. Focus changes caused by moving primitives are delayed by a frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay)
+	bool bUseAsyncRayQuery = false;
+
+	/** Distance the ray start and end can move before the scene query is repeated, when reusing or running asynchronous ray queries. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay,
+		meta = (EditCondition = "bReuseRayQuery || bUseAsyncRayQuery", ClampMin = "0.0"))
+	float RayQueryMargin = 5.0f;
+
+	/** Maximum time in seconds between full scene queries, when reusing or running asynchronous ray queries. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay,
+		meta = (EditCondition = "bReuseRayQuery || bUseAsyncRayQuery", ClampMin = "0.0"))
+	float MaxRayQueryInterval = 0.2f;
+
+	/**
+	 * Select far targets within a cone around the ray instead of only the targets hit by the ray, making small targets easier
+	 * to point at. Candidates are gathered from the bounds of far targets in the target registry and scored by their angle from
+	 * the ray and their depth. Targets behind the primitive hit by the ray are occluded.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay)
+	bool bUseConeCast = false;
+
+	/** Half angle of the cone in degrees. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay,
+		meta = (EditCondition = "bUseConeCast", ClampMin = "0.0", ClampMax = "45.0"))
+	float ConeCastAngle = 5.0f;
+
+	/**
+	 * Weight of the target depth relative to its angle when scoring cone cast candidates.
+	 * A candidate at the end of the ray scores as much worse as one at this fraction of the cone angle.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay,
+		meta = (EditCondition = "bUseConeCast", ClampMin = "0.0"))
+	float ConeCastDepthWeight = 0.25f;
+
+	/**
+	 * Fraction by which the focused target is favored over other cone cast candidates, to avoid focus flickering between targets.
+	 * The focused target stays selected up to this fraction beyond the cone angle and its score is reduced by the same fraction.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay,
+		meta = (EditCondition = "bUseConeCast", ClampMin = "0.0", ClampMax = "1.0"))
+	float ConeCastHysteresis = 0.2f;
+
 	UPROPERTY(BlueprintAssignable, Category = "Uxt Far Pointer")
 	FUxtFarPointerEnabledDelegate OnFarPointerEnabled;
 
@@ -115,12 +229,9 @@ public:
 	FUxtFarPointerDisabledDelegate OnFarPointerDisabled;
 
 private:
+	/** Write the pointer position to the world's parameter collection buffer. */
 	void UpdateParameterCollection(FVector IndexTipPosition);
 
-	/** Parameter collection used to store the finger tip position */
-	UPROPERTY(Transient)
-	UMaterialParameterCollection* ParameterCollection;
-
 	/** Pointer origin as reported by the hand tracker. */
 	FVector PointerOrigin = FVector::ZeroVector;
 
@@ -138,7 +249,37 @@ private:
 	/** Far target that owns the hit primitive, if any. */
 	TWeakObjectPtr<UObject> FarTargetWeak;
 
+	/** Overlap results of the expanded ray query, kept to reuse the allocation between queries. */
+	TArray<FOverlapResult> RayOverlaps;
+
+	/** Primitives blocking the trace channel around the ray of the last expanded query. */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> RayCandidates;
+
+	/** Ray, margin and settings of the query the ray candidates were found with. */
+	FVector RayCandidatesStart = FVector::ZeroVector;
+	FVector RayCandidatesEnd = FVector::ZeroVector;
+	float RayCandidatesMargin = -1.0f;
+	float RayCandidatesTime = 0.0f;
+	TEnumAsByte<ECollisionChannel> RayCandidatesChannel = ECollisionChannel::ECC_Visibility;
+
+	/** Far target hit instead of the focused one, waiting for the focus switch dwell time to pass, and when it was first hit. */
+	TWeakObjectPtr<UPrimitiveComponent> PendingFocusPrimitiveWeak;
+	float PendingFocusTime = 0.0f;
+
+	/** Candidates of the cone cast, kept to reuse the allocation between frames. */
+	TArray<FUxtConeQueryCandidate> ConeCandidates;
+
+	/** Pending asynchronous ray query and the ray, margin, time and channel it was requested with. */
+	FTraceHandle AsyncRayQuery;
+	FVector AsyncRayQueryStart = FVector::ZeroVector;
+	FVector AsyncRayQueryEnd = FVector::ZeroVector;
+	float AsyncRayQueryMargin = 0.0f;
+	float AsyncRayQueryTime = 0.0f;
+	TEnumAsByte<ECollisionChannel> AsyncRayQueryChannel = ECollisionChannel::ECC_Visibility;
+
 	bool bPressed = false;
 
 	bool bEnabled = false;
+
+	friend class UUxtFarPointerQuerySubsystem;
 };
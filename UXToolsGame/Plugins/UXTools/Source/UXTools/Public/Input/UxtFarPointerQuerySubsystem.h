@@ -0,0 +1,81 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "UxtFarPointerQuerySubsystem.generated.h"
+
+class UPrimitiveComponent;
+class UUxtFarPointerComponent;
+
+/**
+ * World subsystem that resolves the rays of all far pointers of the world together.
+ *
+ * When the first far pointer asks for its hit in a frame, the rays of all registered far pointers are gathered and traced at once,
+ * in parallel on worker threads if there is more than one. Pointers then pick up their own result instead of tracing the scene
+ * individually. Pointers reusing or running asynchronous ray queries trace their cached candidates themselves and are not batched.
+ *
+ * Hit primitives are mapped to far targets through the component cache of the target registry, and the result is shared by all
+ * pointers hitting the same primitive in a frame.
+ */
+UCLASS(ClassGroup = "UXTools")
+class UXTOOLS_API UUxtFarPointerQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//
+	// USubsystem interface
+
+	virtual void Deinitialize() override;
+
+	/** Add a far pointer to the rays traced in each frame. */
+	void RegisterPointer(UUxtFarPointerComponent* Pointer);
+
+	/** Remove a far pointer from the rays traced in each frame. */
+	void UnregisterPointer(UUxtFarPointerComponent* Pointer);
+
+	/**
+	 * Get the hit of the pointer's ray in the current frame, tracing the rays of all registered pointers if not done yet this frame.
+	 * Returns false if the given ray has not been traced, e.g. because the pointer's ray changed since the rays were gathered,
+	 * in which case the pointer must trace the ray itself. OutHit has no component if the ray did not hit anything.
+	 */
+	bool GetRayHit(const UUxtFarPointerComponent* Pointer, const FVector& Start, const FVector& End, FHitResult& OutHit);
+
+	/** Find the far target the primitive belongs to, if any. */
+	UObject* FindFarTarget(UPrimitiveComponent* Primitive);
+
+	/** Minimum number of rays traced on worker threads. Fewer rays are traced on the calling thread. */
+	static constexpr int32 MinParallelRays = 2;
+
+private:
+	/** Ray of a pointer and its hit in the current frame. */
+	struct FPointerRay
+	{
+		const UUxtFarPointerComponent* Pointer;
+		FVector Start;
+		FVector End;
+		ECollisionChannel TraceChannel;
+		FHitResult Hit;
+	};
+
+	/** Gather the rays of all registered pointers and trace them. */
+	void TraceRays();
+
+	/** Far pointers taking part in the batched traces. */
+	TArray<TWeakObjectPtr<UUxtFarPointerComponent>> Pointers;
+
+	/** Rays traced in the current frame. */
+	TArray<FPointerRay> Rays;
+
+	/** Far targets of the primitives hit in the current frame. */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, TWeakObjectPtr<UObject>> FarTargets;
+
+	/** Frame in which the rays have been traced last. */
+	uint64 RaysFrame = MAX_uint64;
+};
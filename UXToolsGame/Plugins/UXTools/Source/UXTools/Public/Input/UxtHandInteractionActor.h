@@ -100,6 +100,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Hand Interaction", AdvancedDisplay, meta = (ExposeOnSpawn = true))
 	bool bShowNearCursorOnGrabTargets = false;
 
+	/** Use the world's target registry for near pointer proximity queries. Changes to this value after BeginPlay have no effect. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Hand Interaction", AdvancedDisplay)
+	bool bUseTargetRegistry = false;
+
 	/** Active interaction modes */
 	UPROPERTY(
 		Transient, EditAnywhere, BlueprintReadWrite, Category = "Uxt Hand Interaction", meta = (Bitmask, BitmaskEnum = EUxtInteractionMode))
@@ -109,8 +113,8 @@ private:
 	/** Generates a cone-shaped mesh for proximity testing. */
 	void UpdateProximityMesh();
 
-	/** Update the velocity of the hand. */
-	void UpdateVelocity(float DeltaTime);
+	/** Update the velocity of the hand from the hand history. */
+	void UpdateVelocity();
 
 	/** Check if there are near interaction targets in the proximity cone to switch between near and far interaction.
 	 *  The proximity cone is intended to represent a natural volume where a person would intend to interact with a physical object.
@@ -164,17 +168,12 @@ private:
 	/** Set to true for visualizing the proximity mesh. */
 	bool bRenderProximityMesh = false;
 
-	/** The current velocity of the hand. */
+	/** The current velocity of the hand in cm/s. */
 	FVector Velocity = FVector::ZeroVector;
 
-	/** The current angular velocity of the hand. */
+	/** The current angular velocity of the hand, as rotation axis scaled by degrees per second. */
 	FVector AngularVelocity = FVector::ZeroVector;
 
-	// Velocity internal state
-	static const int VelocityUpdateInterval = 6;
-	uint64 CurrentFrame = 0;
-	FVector VelocityPositionsCache[VelocityUpdateInterval];
-	FVector VelocityNormalsCache[VelocityUpdateInterval];
-	FVector VelocityPositionsSum = FVector::ZeroVector;
-	FVector VelocityNormalsSum = FVector::ZeroVector;
+	/** Time window in seconds over which the hand velocities are estimated. */
+	static constexpr float VelocityTimeWindow = 0.1f;
 };
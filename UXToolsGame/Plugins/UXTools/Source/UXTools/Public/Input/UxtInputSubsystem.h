@@ -8,6 +8,7 @@
 #include "Components/ActorComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Templates/Function.h"
 
 #include "UxtInputSubsystem.generated.h"
 
@@ -107,7 +108,7 @@ public:
 private:
 	/** Dispatch the given event to interested handlers. */
 	template <typename HandlerType, typename FuncType>
-	void RaiseEvent(UPrimitiveComponent* Target, const FuncType& Callback) const;
+	void RaiseEvent(UPrimitiveComponent* Target, const FuncType& Callback);
 
 	/** Can the given handler handle events for the given primitive. */
 	template <typename HandlerType>
@@ -120,53 +121,91 @@ private:
 	template <>
 	bool CanHandle<UUxtPokeHandler>(UObject* Handler, UPrimitiveComponent* Primitive) const;
 
-	/** Dispatch the given event to interested handlers that share a parent Actor with Target. */
-	template <typename HandlerType, typename FuncType>
-	void ExecuteHierarchy(UPrimitiveComponent* Target, const FuncType& Callback, const TSet<UObject*>& Handled) const;
+	/**
+	 * Call the function for each component of the actor implementing the handler interface.
+	 * Components come from the target registry cache of the actor's world if available.
+	 * The cached list is iterated in place, so the function must not raise events or query the registry.
+	 */
+	void ForEachHandlerComponent(AActor* Owner, UClass* HandlerClass, TFunctionRef<void(UActorComponent*)> Callback) const;
+
+	/** Add handlers that share a parent Actor with Target to the dispatch buffer, skipping global listeners. */
+	template <typename HandlerType>
+	void GatherHierarchy(UPrimitiveComponent* Target, const TSet<UObject*>* GlobalListeners, TArray<UObject*>& OutHandlers) const;
 
 private:
 	// Map contains array of listeners for each type of handler registered
 	TMap<UClass*, TSet<UObject*>> Listeners;
+
+	/**
+	 * Handlers of the events currently being dispatched, one buffer per nesting level.
+	 * Buffers are kept between events so that dispatching does not allocate.
+	 */
+	TArray<TArray<UObject*>> DispatchBuffers;
+
+	/** Number of events currently being dispatched. */
+	int32 DispatchDepth = 0;
 };
 
 template <typename HandlerType, typename FuncType>
-void UUxtInputSubsystem::RaiseEvent(UPrimitiveComponent* Target, const FuncType& Callback) const
+void UUxtInputSubsystem::RaiseEvent(UPrimitiveComponent* Target, const FuncType& Callback)
 {
-	// If a global listener is under the same actor as Target, dispatching an event to it
-	// would duplicate the event, as it will also be dispatched here and in ExecuteHierarchy.
-	// In these situations, in order to only dispatch once, we keep track of a set of handlers
-	// that have already received this event.
-	TSet<UObject*> Handled;
+	// Handlers are gathered before dispatching, so that callbacks can register handlers or add components.
+	// Events raised from callbacks use the next buffer.
+	const int32 Depth = DispatchDepth++;
+	if (DispatchBuffers.Num() <= Depth)
+	{
+		DispatchBuffers.AddDefaulted();
+	}
+	DispatchBuffers[Depth].Reset();
 
-	for (UObject* Handler : Listeners.FindRef(HandlerType::StaticClass()))
+	const TSet<UObject*>* GlobalListeners = Listeners.Find(HandlerType::StaticClass());
+	if (GlobalListeners)
 	{
-		if (CanHandle<HandlerType>(Handler, Target))
+		for (UObject* Handler : *GlobalListeners)
+		{
+			if (CanHandle<HandlerType>(Handler, Target))
+			{
+				DispatchBuffers[Depth].Add(Handler);
+			}
+		}
+	}
+
+	GatherHierarchy<HandlerType>(Target, GlobalListeners, DispatchBuffers[Depth]);
+
+	// Buffer array may be reallocated by nested events, index it on every iteration.
+	// Handlers destroyed by earlier callbacks are skipped, handlers added by them only receive the following events.
+	for (int32 Index = 0; Index < DispatchBuffers[Depth].Num(); ++Index)
+	{
+		UObject* Handler = DispatchBuffers[Depth][Index];
+		if (IsValid(Handler))
 		{
 			Callback(Handler);
-			Handled.Add(Handler);
 		}
 	}
 
-	ExecuteHierarchy<HandlerType>(Target, Callback, Handled);
+	DispatchBuffers[Depth].Reset();
+	--DispatchDepth;
 }
 
-template <typename HandlerType, typename FuncType>
-void UUxtInputSubsystem::ExecuteHierarchy(UPrimitiveComponent* Target, const FuncType& Callback, const TSet<UObject*>& Handled) const
+template <typename HandlerType>
+void UUxtInputSubsystem::GatherHierarchy(
+	UPrimitiveComponent* Target, const TSet<UObject*>* GlobalListeners, TArray<UObject*>& OutHandlers) const
 {
-	if (Target && Target->GetOwner())
+	// If a global listener is under the same actor as Target, dispatching an event to it
+	// would duplicate the event, as it has already been added from the global listeners.
+	AActor* Owner = Target ? Target->GetOwner() : nullptr;
+	if (!Owner)
 	{
-		TArray<UActorComponent*> ComponentsToUpdate;
-		for (UActorComponent* Component : Target->GetOwner()->GetComponents())
+		return;
+	}
+
+	ForEachHandlerComponent(
+		Owner, HandlerType::StaticClass(),
+		[this, Target, GlobalListeners, &OutHandlers](UActorComponent* Component)
 		{
-			if (Component->Implements<HandlerType>() && CanHandle<HandlerType>(Component, Target) && !Handled.Contains(Component))
+			if (!(GlobalListeners && GlobalListeners->Contains(Component)) && CanHandle<HandlerType>(Component, Target))
 			{
-				ComponentsToUpdate.Add(Component);
+				OutHandlers.Add(Component);
 			}
-		}
-
-		for (UActorComponent* Component : ComponentsToUpdate)
-		{
-			Callback(Component);
-		}
-	}
+		});
 }
@@ -5,17 +5,19 @@
 
 #include "CoreMinimal.h"
 #include "EngineDefines.h"
+#include "HeadMountedDisplayTypes.h"
 #include "InputCoreTypes.h"
 #include "UxtPointerComponent.h"
 
 #include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
 
 #include "UxtNearPointerComponent.generated.h"
 
 struct FUxtPointerFocus;
 struct FUxtGrabPointerFocus;
 struct FUxtPokePointerFocus;
-class UMaterialParameterCollection;
 
 /**
  * Adds poke and grab interactions to an actor.
@@ -93,6 +95,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Uxt Near Pointer")
 	float GetPokePointerRadius() const;
 
+	/** Returns the pointers created for the additional poke joints of this pointer. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Near Pointer")
+	TArray<UUxtNearPointerComponent*> GetFingerPointers() const;
+
+	/** Returns the pointer that created this finger pointer, or null if this is not a finger pointer. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Near Pointer")
+	UUxtNearPointerComponent* GetPrimaryPointer() const;
+
+	/** Whether this pointer was created for an additional poke joint of another pointer. */
+	bool IsFingerPointer() const;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Near Pointer")
 	TEnumAsByte<ECollisionChannel> TraceChannel = ECollisionChannel::ECC_Visibility;
 
@@ -121,6 +134,56 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Near Pointer")
 	float DebounceDepth = 0.5f;
 
+	/** Hand joint used as the poke pointer. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Near Pointer")
+	EHandKeypoint PokeJoint = EHandKeypoint::IndexTip;
+
+	/**
+	 * Additional hand joints that can poke targets, e.g. the other finger tips.
+	 * A finger pointer is created for each joint on begin play. Finger pointers poke targets like any other near pointer, but don't
+	 * grab, and find their targets among the candidates of this pointer's proximity query, which is expanded to cover all joints.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Uxt Near Pointer", AdvancedDisplay)
+	TArray<EHandKeypoint> AdditionalPokeJoints;
+
+	/**
+	 * Query the world's target registry for proximity candidates instead of running a physics overlap on the whole scene.
+	 * Only primitives of actors owning grab or poke targets are considered, which is cheaper in scenes with many non-interactable
+	 * colliders. See UUxtTargetRegistrySubsystem for how target actors are discovered.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Near Pointer", AdvancedDisplay)
+	bool bUseTargetRegistry = false;
+
+	/**
+	 * Reuse the candidates of the last proximity query while the pointer moves less than ProximityQueryMargin.
+	 * The proximity query is expanded by the margin and on the following frames only the cached candidates are tested against the
+	 * proximity radius, which is cheaper than a scene query while the hand is held nearly still.
+	 * Primitives moving into range on their own are only found by the next full query, see MaxProximityQueryInterval.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Near Pointer", AdvancedDisplay)
+	bool bReuseProximityQuery = false;
+
+	/**
+	 * Run the proximity query asynchronously and use its results in the next frame, moving the scene query off the game thread.
+	 * The results are only used if the pointer has moved less than ProximityQueryMargin since the query was requested,
+	 * otherwise the pointer falls back to a synchronous query. Focus changes caused by moving primitives are delayed by a frame.
+	 * Poke contact is always tested synchronously. Does not apply when using the target registry.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Near Pointer", AdvancedDisplay)
+	bool bUseAsyncProximityQuery = false;
+
+	/** Distance the pointer can move before the proximity query is repeated, when reusing or running asynchronous proximity queries. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Near Pointer", AdvancedDisplay,
+		meta = (EditCondition = "bReuseProximityQuery || bUseAsyncProximityQuery", ClampMin = "0.0"))
+	float ProximityQueryMargin = 2.0f;
+
+	/** Maximum time in seconds between full proximity queries, when reusing or running asynchronous proximity queries. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Near Pointer", AdvancedDisplay,
+		meta = (EditCondition = "bReuseProximityQuery || bUseAsyncProximityQuery", ClampMin = "0.0"))
+	float MaxProximityQueryInterval = 0.2f;
+
 protected:
 	/** Focus of the grab pointer */
 	FUxtGrabPointerFocus* GrabFocus;
@@ -129,24 +192,83 @@ protected:
 	FUxtPokePointerFocus* PokeFocus;
 
 private:
+	/** Write the pointer position to the world's parameter collection buffer. */
 	void UpdateParameterCollection(FVector IndexTipPosition);
 
+	/**
+	 * Find primitives within the proximity radius of the given location and store them in ProximityPrimitives.
+	 * Primitives within the query radius are kept as proximity candidates for finger pointers.
+	 */
+	void QueryProximityPrimitives(const FVector& ProximityCenter, float QueryRadius);
+
+	/** Run a scene or target registry query for primitives within the given radius and store them in ProximityPrimitives. */
+	void QueryScene(const FVector& Center, float Radius);
+
+	/** Request an expanded proximity query around the given location, to be consumed in the next frame. */
+	void RequestAsyncProximityQuery(const FVector& ProximityCenter, float QueryRadius);
+
+	/** Store the results of the asynchronous query requested in the previous frame as proximity candidates, if available. */
+	void ConsumeAsyncProximityQuery();
+
+	/** Whether the candidates of the last expanded query contain all primitives within the query radius of the location. */
+	bool CanReuseProximityCandidates(const FVector& ProximityCenter, float QueryRadius) const;
+
+	/** Store the candidates within the proximity radius of the given location in ProximityPrimitives. */
+	void FilterProximityCandidates(const TArray<TWeakObjectPtr<UPrimitiveComponent>>& Candidates, const FVector& ProximityCenter);
+
+	/** Update the poke interaction of a finger pointer using the proximity candidates of its primary pointer. */
+	void TickFingerPointer();
+
+	/** Create a finger pointer for each of the additional poke joints. */
+	void CreateFingerPointers();
+
+	/** Destroy the finger pointers created on begin play. */
+	void DestroyFingerPointers();
+
 #if ENABLE_VISUAL_LOG
 	void VLogPointer(
 		const FName& LogCategoryName, const FColor& LogColor, const FString& Label, const FVector& PointerLocation, float PointerRadius,
 		const FUxtPointerFocus* Focus) const;
 #endif // ENABLE_VISUAL_LOG
 
-	/** Parameter collection used to store the finger tip position */
-	UPROPERTY(Transient)
-	UMaterialParameterCollection* ParameterCollection;
-
 	FTransform GrabPointerTransform;
 
 	FTransform PokePointerTransform;
 
+	/** Poke joint radius, cached together with the pointer transforms. */
+	float PokePointerRadius = 0.0f;
+
 	FVector PreviousPokePointerLocation;
 
+	/** Overlap results of the proximity query, kept to reuse the allocation between frames. */
+	TArray<FOverlapResult> ProximityOverlaps;
+
+	/** Primitives found by the last proximity query. Only valid during the tick. */
+	TArray<UPrimitiveComponent*> ProximityPrimitives;
+
+	/** Primitives found by the last expanded proximity query, reused while the pointer stays within the query margin. */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> ProximityCandidates;
+
+	/** Center, radius and settings of the query the proximity candidates were found with. */
+	FVector ProximityCandidatesCenter = FVector::ZeroVector;
+	float ProximityCandidatesRadius = -1.0f;
+	float ProximityCandidatesTime = 0.0f;
+	TEnumAsByte<ECollisionChannel> ProximityCandidatesChannel = ECollisionChannel::ECC_Visibility;
+	bool bProximityCandidatesFromRegistry = false;
+
+	/** Pending asynchronous proximity query and the radius, time and channel it was requested with. */
+	FTraceHandle AsyncProximityQuery;
+	float AsyncProximityQueryRadius = 0.0f;
+	float AsyncProximityQueryTime = 0.0f;
+	TEnumAsByte<ECollisionChannel> AsyncProximityQueryChannel = ECollisionChannel::ECC_Visibility;
+
+	/** Pointers for the additional poke joints, ticking after this pointer. */
+	UPROPERTY(Transient)
+	TArray<UUxtNearPointerComponent*> FingerPointers;
+
+	/** Pointer providing the proximity candidates, if this is a finger pointer. */
+	TWeakObjectPtr<UUxtNearPointerComponent> PrimaryPointerWeak;
+
 	bool bWasBehindFrontFace = false;
 
 	bool bHandWasGrabbing = false;
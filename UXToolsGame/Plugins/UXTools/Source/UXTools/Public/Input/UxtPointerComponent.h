@@ -45,6 +45,21 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Pointer")
 	EControllerHand Hand = EControllerHand::AnyHand;
 
+	/**
+	 * Distance by which another target must be closer than the focused target for the pointer to switch focus to it.
+	 * For near pointers this compares the distances to the targets, for far pointers the focused target is kept while the ray
+	 * passes within this distance of it. Avoids focus flickering between neighboring targets with noisy hand data.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Pointer", AdvancedDisplay, meta = (ClampMin = "0.0"))
+	float FocusSwitchMargin = 0.0f;
+
+	/**
+	 * Time in seconds another target must remain the best candidate before the pointer switches focus to it from the focused target.
+	 * Focus is gained and lost immediately, only switching between targets is delayed.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Pointer", AdvancedDisplay, meta = (ClampMin = "0.0"))
+	float FocusSwitchDwellTime = 0.0f;
+
 protected:
 	/** The lock state of the pointer. */
 	bool bFocusLocked = false;
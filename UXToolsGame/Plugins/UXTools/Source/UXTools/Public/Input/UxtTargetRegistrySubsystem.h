@@ -0,0 +1,253 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "UxtTargetRegistrySubsystem.generated.h"
+
+class AActor;
+class UActorComponent;
+class UBodySetup;
+class UPrimitiveComponent;
+
+/**
+ * Collision geometry of a poke target primitive, as used by the near pointer to detect front face pokes.
+ * Only contains plain data, so that the poke state machine does not need to inspect the body setup on every check.
+ */
+struct UXTOOLS_API FUxtPokeGeometry
+{
+	/** Collision shape types relevant for poking. */
+	enum class EShape : uint8
+	{
+		/** Simple collision only consists of boxes. */
+		Box,
+		/** Any other collision. */
+		Other
+	};
+
+	FUxtPokeGeometry() = default;
+	explicit FUxtPokeGeometry(const UPrimitiveComponent& Primitive);
+
+	/** Returns true if the primitive's collision has not changed since the descriptor was built. */
+	bool IsValidFor(const UPrimitiveComponent& Primitive) const;
+
+	EShape Shape = EShape::Other;
+
+	/** Bounds of the primitive in component space, excluding component scale. */
+	FBoxSphereBounds LocalBounds = FBoxSphereBounds(ForceInitToZero);
+
+	/** Front face plane in component space, facing along the component X axis. */
+	FPlane FrontFace = FPlane(FVector::ForwardVector, 0.0f);
+
+private:
+	/** Body setup and hash of its simple collision at the time the descriptor was built. */
+	const UBodySetup* BodySetup = nullptr;
+	uint32 CollisionHash = 0;
+};
+
+/** Components of an actor implementing an interface or deriving from a class, as cached by the target registry. */
+using FUxtComponentList = TArray<TWeakObjectPtr<UActorComponent>, TInlineAllocator<4>>;
+
+/** Primitive of a far target actor whose bounds are within a cone. */
+struct FUxtConeQueryCandidate
+{
+	UPrimitiveComponent* Primitive;
+
+	/** Angle in radians between the cone axis and the closest point of the primitive bounds. */
+	float Angle;
+
+	/** Distance of the bounds center along the cone axis, clamped to the cone length. */
+	float Depth;
+};
+
+/**
+ * World subsystem that keeps track of the actors owning near interaction targets, i.e. components implementing the grab or poke
+ * target interfaces.
+ *
+ * Primitives of these actors are stored in a loose grid that near pointers can query for proximity candidates,
+ * instead of running a generic physics overlap against the whole scene.
+ *
+ * Bounding spheres of the primitives of actors owning far targets are kept in a flat index as well, so that far pointers can
+ * gather targets within a cone without tracing inflated collision.
+ *
+ * The subsystem also caches, per actor, the components implementing each pointer interface so that pointers can map
+ * primitives to their targets without interface reflection in the hot loop, as well as the poke geometry of primitives.
+ *
+ * Actors are discovered when their primitives create or destroy their physics state. UXT target components refresh their owner
+ * when registered or unregistered, actors that gain any other target component after their primitives have been registered must
+ * be refreshed explicitly using InvalidateActor.
+ */
+UCLASS(ClassGroup = "UXTools")
+class UXTOOLS_API UUxtTargetRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//
+	// USubsystem interface
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//
+	// UWorldSubsystem interface
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** Re-evaluate whether the given actor owns near or far interaction targets and refresh its primitives. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Input")
+	void InvalidateActor(AActor* Actor);
+
+	/** Invalidate the owner of a target component in the component's world, see InvalidateActor. */
+	static void InvalidateOwner(const UActorComponent* Component);
+
+	/**
+	 * Find all primitives of target actors overlapping the given sphere.
+	 * Only primitives with query collision enabled that do not ignore the trace channel are returned,
+	 * matching the results of an overlap query by channel.
+	 */
+	void QueryProximity(const FVector& Center, float Radius, ECollisionChannel TraceChannel, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+	/**
+	 * Find the primitives of far target actors whose bounds intersect the given cone.
+	 * Only primitives with query collision enabled blocking the trace channel are returned. Bounds are conservative,
+	 * callers should test the primitive collision of the candidates.
+	 */
+	void QueryCone(
+		const FVector& Origin, const FVector& Direction, float Length, float HalfAngle, ECollisionChannel TraceChannel,
+		TArray<FUxtConeQueryCandidate>& OutCandidates);
+
+	/**
+	 * Get the components of the actor that implement the given interface, or derive from the given class if it is not an interface.
+	 * Components are listed in the same order as AActor::GetComponents. The list is cached and rebuilt when the number of components
+	 * changes or the actor is invalidated. Components replaced or moved to another actor without changing the number of components
+	 * are detected in the next frame.
+	 *
+	 * The list is owned by the registry and is only valid until the registry is used again.
+	 */
+	const FUxtComponentList& GetCachedComponents(AActor* Actor, UClass* Class);
+
+	/**
+	 * Get the poke geometry of a primitive. The descriptor is built on first use and rebuilt when the primitive's physics state is
+	 * recreated or its simple collision changes.
+	 */
+	FUxtPokeGeometry GetPokeGeometry(const UPrimitiveComponent* Primitive);
+
+	/** Size of the grid cells in world units. Primitives larger than a cell are tested separately on every query. */
+	static constexpr float CellSize = 50.0f;
+
+private:
+	/** Primitive entry in the grid, with bounds cached at the time the grid was built. */
+	struct FGridEntry
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Primitive;
+		FBox Bounds;
+		FIntVector Cell;
+	};
+
+	/** Components of an actor implementing an interface or deriving from a class. */
+	struct FClassComponents
+	{
+		UClass* Class;
+		FUxtComponentList Components;
+	};
+
+	/** Cached components of an actor. */
+	struct FActorComponentCache
+	{
+		/** Signature of the set of components owned by the actor when the cache was built, see GetComponentsSignature. */
+		uint32 ComponentsSignature = 0;
+		int32 NumOwnedComponents = INDEX_NONE;
+
+		/** Frame in which the signature has been compared last, it is compared at most once per frame. */
+		uint64 ValidatedFrame = MAX_uint64;
+
+		TArray<FClassComponents, TInlineAllocator<4>> Classes;
+	};
+
+	/** Range of entries belonging to a grid cell. */
+	struct FCellRange
+	{
+		int32 Start;
+		int32 Num;
+	};
+
+	void OnCreatePhysicsState(UActorComponent* Component);
+	void OnDestroyPhysicsState(UActorComponent* Component);
+
+	/** Update the primitive lists of all actors that have been invalidated since the last query. */
+	void UpdateDirtyActors();
+
+	/** Rebuild the grid from the current primitive bounds. */
+	void RebuildGrid();
+
+	/** Rebuild the far target bounds from the current primitive bounds. */
+	void RebuildFarTargetBounds();
+
+	/** Test a grid entry against the query sphere and add it to the results if it overlaps. */
+	void TestEntry(
+		const FGridEntry& Entry, const FVector& Center, float Radius, ECollisionChannel TraceChannel,
+		TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/** Remove cache entries of actors that have been destroyed. */
+	void PruneComponentCache();
+
+	/** Remove poke geometry entries of primitives that have been destroyed. */
+	void PrunePokeGeometryCache();
+
+	static FIntVector GetCell(const FVector& Location);
+
+	/**
+	 * Order independent hash of the components owned by the actor. Weak object hashes include the object serial number,
+	 * so a component replaced by a new one allocated in the same slot changes the signature as well.
+	 */
+	static uint32 GetComponentsSignature(const TSet<UActorComponent*>& OwnedComponents);
+
+	FDelegateHandle CreatePhysicsStateHandle;
+	FDelegateHandle DestroyPhysicsStateHandle;
+
+	/** Actors whose target components or primitives may have changed. */
+	TSet<TWeakObjectPtr<AActor>> DirtyActors;
+
+	/** Primitives of each actor owning near interaction targets. */
+	TMap<TWeakObjectPtr<AActor>, TArray<TWeakObjectPtr<UPrimitiveComponent>>> TargetActors;
+
+	/** Primitives of each actor owning far targets. */
+	TMap<TWeakObjectPtr<AActor>, TArray<TWeakObjectPtr<UPrimitiveComponent>>> FarTargetActors;
+
+	/** Bounding spheres of far target primitives and the primitives they belong to, at matching indices. */
+	TArray<FSphere> FarTargetBounds;
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> FarTargetPrimitives;
+
+	/** Grid entries, sorted by cell. */
+	TArray<FGridEntry> GridEntries;
+
+	/** Entries too large to be stored in a single cell. */
+	TArray<FGridEntry> LargeEntries;
+
+	/** Entry range of each occupied cell. */
+	TMap<FIntVector, FCellRange> GridCells;
+
+	/** Cached components of actors. */
+	TMap<TWeakObjectPtr<AActor>, FActorComponentCache> ComponentCache;
+
+	/** Cache size at which stale entries are pruned next. */
+	int32 ComponentCachePruneSize = 64;
+
+	/** Cached poke geometry of primitives. */
+	TMap<TWeakObjectPtr<const UPrimitiveComponent>, FUxtPokeGeometry> PokeGeometryCache;
+
+	/** Poke geometry cache size at which stale entries are pruned next. */
+	int32 PokeGeometryCachePruneSize = 64;
+
+	/** Frame in which the grid has been built last. */
+	uint64 GridFrame = MAX_uint64;
+
+	/** Frame in which the far target bounds have been built last. */
+	uint64 FarTargetBoundsFrame = MAX_uint64;
+};
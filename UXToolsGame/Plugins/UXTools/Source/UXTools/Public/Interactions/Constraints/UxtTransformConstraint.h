@@ -15,7 +15,8 @@
  *
  * Usage:
  * Derive from this component and implement ApplyConstraint and GetConstraintType.
- * Custom constraints will automatically be picked up by a UxtConstraintManager on the same actor
+ * Custom constraints will automatically be picked up by a UxtConstraintManager on the same actor when they are registered.
+ * The constraint type is cached at that point, so GetConstraintType must not change while the constraint is registered.
  */
 UCLASS(Abstract, Blueprintable, ClassGroup = "UXTools", meta = (BlueprintSpawnableComponent))
 class UXTOOLS_API UUxtTransformConstraint : public UActorComponent
@@ -31,6 +32,12 @@ public:
 	/** Intended to be called on manipulation started */
 	virtual void Initialize(const FTransform& WorldPose);
 
+protected:
+	//
+	// UActorComponent interface
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+
 public:
 	/** Whether this constraint applies to one hand manipulation, two hand manipulation or both. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Constraint", meta = (Bitmask, BitmaskEnum = EUxtGrabMode))
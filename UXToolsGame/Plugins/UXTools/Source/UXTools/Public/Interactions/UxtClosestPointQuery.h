@@ -0,0 +1,39 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Closest point queries on the collision of primitives.
+ *
+ * Static mesh and shape components whose simple collision only consists of boxes, spheres and capsules are evaluated
+ * analytically, several shapes at a time using vector instructions. Other primitives, e.g. with convex or complex collision,
+ * fall back to the physics engine query. Results match UPrimitiveComponent::GetSquaredDistanceToCollision:
+ * points inside the collision are their own closest point with a distance of zero.
+ */
+class UXTOOLS_API FUxtClosestPointQuery
+{
+public:
+	/** Returns true if the closest point on the collision of the primitive can be computed without a physics query. */
+	static bool IsAnalyticPrimitive(const UPrimitiveComponent* Primitive);
+
+	/**
+	 * Calculates the point on the primitive collision that is closest to the point passed in.
+	 * Return value indicates whether a point was found, i.e. the primitive has query collision enabled.
+	 */
+	static bool GetClosestPoint(
+		const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutPointOnSurface, float& OutDistanceSqr);
+
+	/**
+	 * Calculates the closest points on the collision of all primitives at once.
+	 * Output arrays must be as large as the primitive array. If no point is found for a primitive, its point is set to the query
+	 * point and its squared distance to a negative value.
+	 */
+	static void GetClosestPoints(
+		TArrayView<const UPrimitiveComponent* const> Primitives, const FVector& Point, TArrayView<FVector> OutPointsOnSurface,
+		TArrayView<float> OutDistancesSqr);
+};
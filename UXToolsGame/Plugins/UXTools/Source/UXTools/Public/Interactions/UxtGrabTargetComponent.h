@@ -227,6 +227,8 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 	//
 	// IUxtGrabTarget interface
@@ -64,8 +64,9 @@ public:
 protected:
 	//
 	// UActorComponent interface
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
@@ -86,12 +87,26 @@ protected:
 	void NotifyManipulationStarted();
 
 private:
+	friend class UUxtTransformConstraint;
+
+	/** Called by constraints on the owning actor when they are registered. */
+	void OnConstraintRegistered(UUxtTransformConstraint* Constraint);
+
+	/** Called by constraints on the owning actor when they are unregistered. */
+	void OnConstraintUnregistered(UUxtTransformConstraint* Constraint);
+
 	/** Get a list of constraints that should be applied. */
 	TArray<UUxtTransformConstraint*> GetConstraints() const;
 
-	/** Update the list registed constraints to be applied. */
+	/** Rebuild the list of constraints to be applied, initializing the ones that were not active yet. */
 	void UpdateActiveConstraints();
 
+	/** Add a constraint to the active list and to the list of its transform mode. */
+	void AddActiveConstraint(UUxtTransformConstraint* Constraint);
+
+	/** Get the active constraints applied in the given transform mode, in the order they are applied. */
+	const TArray<UUxtTransformConstraint*>& GetModeConstraints(EUxtTransformMode TransformMode) const;
+
 	/** Converts @ref MinScale and @ref MaxScale between relative/absolute, based on the value of @ref bRelativeToInitialScale. */
 	void ConvertMinMaxScaleValues();
 
@@ -128,6 +143,11 @@ private:
 	/** The list constraints currently being applied. */
 	TArray<UUxtTransformConstraint*> ActiveConstraints;
 
+	/** Active constraints split by transform mode, so that each phase only visits the constraints it applies. */
+	TArray<UUxtTransformConstraint*> TranslationConstraints;
+	TArray<UUxtTransformConstraint*> RotationConstraints;
+	TArray<UUxtTransformConstraint*> ScalingConstraints;
+
 	/** The component to use for a reference transform when initializing constraints. */
 	USceneComponent* TargetComponent = nullptr;
 
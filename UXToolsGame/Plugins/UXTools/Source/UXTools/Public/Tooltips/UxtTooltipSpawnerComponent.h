@@ -75,6 +75,8 @@ class UXTOOLS_API UUxtTooltipSpawnerComponent
 
 public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 public:
 	/** Delegate to drive OnShow events. */
@@ -5,6 +5,8 @@
 
 #include "CoreMinimal.h"
 
+#include "HandTracking/UxtHandJointFilter.h"
+#include "HandTracking/UxtHandPosePredictor.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 
 #include "UxtFunctionLibrary.generated.h"
@@ -20,10 +22,32 @@ class UXTOOLS_API UUxtFunctionLibrary : public UBlueprintFunctionLibrary
 	GENERATED_BODY()
 
 public:
-	/** Returns the world space position and orientation of the head. */
+	/**
+	 * Returns the world space position and orientation of the head.
+	 * The pose is sampled once per frame by UUxtHeadPoseSubsystem, so all callers see the same pose within a frame.
+	 */
 	UFUNCTION(BlueprintPure, Category = "UXTools", meta = (WorldContext = "WorldContextObject", UnsafeDuringActorConstruction = "true"))
 	static FTransform GetHeadPose(UObject* WorldContextObject);
 
+	/** Queries the current head pose from the HMD, or from test or simulated data when enabled, bypassing the per-frame cache. */
+	static FTransform QueryHeadPose(UObject* WorldContextObject);
+
+	/** Configure the joint filtering stage of the current hand tracker. Trackers without a filtering stage ignore the settings. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Hand Tracking")
+	static void SetHandJointFilterSettings(const FUxtHandJointFilterSettings& Settings);
+
+	/** Get the joint filter settings of the current hand tracker. */
+	UFUNCTION(BlueprintPure, Category = "UXTools|Hand Tracking")
+	static FUxtHandJointFilterSettings GetHandJointFilterSettings();
+
+	/** Configure the prediction of hand poses of the current hand tracker. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Hand Tracking")
+	static void SetHandPredictionSettings(const FUxtHandPredictionSettings& Settings);
+
+	/** Get the hand pose prediction settings of the current hand tracker. */
+	UFUNCTION(BlueprintPure, Category = "UXTools|Hand Tracking")
+	static FUxtHandPredictionSettings GetHandPredictionSettings();
+
 	/** Returns true if we are running in editor (not game mode or VR preview). */
 	UFUNCTION(BlueprintPure, Category = "UXTools")
 	static bool IsInEditor();
@@ -0,0 +1,90 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "UxtHeadPoseSubsystem.generated.h"
+
+/**
+ * World subsystem that samples the head pose once per frame and keeps a short history of it.
+ *
+ * The pose is sampled before any actor ticks, so all components see the same head pose within a frame.
+ * If the pose is requested before that, e.g. in worlds that don't tick, it is sampled on first use in the frame instead.
+ * UUxtFunctionLibrary::GetHeadPose reads the cached pose from this subsystem.
+ *
+ * Test and simulation overrides in UUxtFunctionLibrary take precedence over the cached pose,
+ * so that changes made to them during a frame are visible immediately.
+ */
+UCLASS(ClassGroup = "UXTools")
+class UXTOOLS_API UUxtHeadPoseSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//
+	// USubsystem interface
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Returns the world space head pose of the current frame. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Head Pose")
+	FTransform GetHeadPose();
+
+	/** Returns the linear velocity of the head in world space, estimated from the pose history. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Head Pose")
+	FVector GetHeadLinearVelocity();
+
+	/** Returns the angular velocity of the head in world space as rotation axis scaled by radians per second. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Head Pose")
+	FVector GetHeadAngularVelocity();
+
+	/**
+	 * Extrapolates the head pose the given time ahead of the current frame, assuming constant velocity.
+	 * The prediction time is clamped to MaxPredictionTime.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Head Pose")
+	FTransform PredictHeadPose(float PredictionTime);
+
+	/** Number of frames kept in the pose history. */
+	static constexpr int32 HistorySize = 8;
+
+	/** Time span of the history used to estimate velocities, in seconds. */
+	static constexpr float VelocityTimeWindow = 0.05f;
+
+	/** Maximum time the head pose can be predicted ahead, in seconds. */
+	static constexpr float MaxPredictionTime = 0.1f;
+
+private:
+	/** Head pose sampled at the given real time. */
+	struct FHeadPoseSample
+	{
+		FTransform Pose;
+		double Time;
+	};
+
+	void OnWorldPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaTime);
+
+	/** Sample the head pose if it has not been sampled in the current frame yet. */
+	void UpdateHeadPose();
+
+	/** Get a history sample, 0 being the most recent one. */
+	const FHeadPoseSample& GetSample(int32 Age) const;
+
+	/** Find the most recent sample that is at least VelocityTimeWindow older than the newest one, or the oldest sample. */
+	const FHeadPoseSample& GetVelocityReferenceSample() const;
+
+	/** Ring buffer of samples, HistoryHead is the index of the most recent one. */
+	TArray<FHeadPoseSample, TInlineAllocator<HistorySize>> History;
+	int32 HistoryHead = INDEX_NONE;
+
+	/** Value of GFrameCounter when the head pose was last sampled. */
+	uint64 LastSampleFrame = 0;
+
+	FDelegateHandle PreActorTickHandle;
+};
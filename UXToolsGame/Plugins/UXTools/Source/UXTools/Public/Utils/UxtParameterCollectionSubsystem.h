@@ -0,0 +1,97 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "UxtParameterCollectionSubsystem.generated.h"
+
+class UMaterialParameterCollection;
+
+/**
+ * World subsystem that buffers writes to the UX Tools material parameter collection and commits them once per frame.
+ *
+ * Pointers write their positions into a local buffer during their tick. Values that changed are committed to the collection
+ * instance of the world after all actors have ticked, before rendering. Components reading the parameters on the CPU are served
+ * from the buffer, so they see the latest values written in the frame without going through the collection instance.
+ *
+ * Parameters are resolved to buffer indices up front, use FindVectorParameter and FindScalarParameter to look them up once.
+ */
+UCLASS(ClassGroup = "UXTools")
+class UXTOOLS_API UUxtParameterCollectionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UUxtParameterCollectionSubsystem();
+
+	//
+	// USubsystem interface
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Returns the index of the vector parameter with the given name or INDEX_NONE if the collection does not contain it. */
+	int32 FindVectorParameter(FName Name) const;
+
+	/** Returns the index of the scalar parameter with the given name or INDEX_NONE if the collection does not contain it. */
+	int32 FindScalarParameter(FName Name) const;
+
+	/** Set the value of a vector parameter, it is committed to the collection at the end of the frame. */
+	void SetVectorParameter(int32 Index, const FLinearColor& Value);
+
+	/** Set the value of a scalar parameter, it is committed to the collection at the end of the frame. */
+	void SetScalarParameter(int32 Index, float Value);
+
+	/** Returns the latest value written to a vector parameter. */
+	const FLinearColor& GetVectorParameter(int32 Index) const;
+
+	/** Returns the latest value written to a scalar parameter. */
+	float GetScalarParameter(int32 Index) const;
+
+	/** Set the position of the pointer of the given hand. */
+	void SetPointerPosition(EControllerHand Hand, const FVector& Position);
+
+	/** Get the latest position of the pointer of the given hand. Returns false if the collection has no parameter for the hand. */
+	bool GetPointerPosition(EControllerHand Hand, FVector& OutPosition) const;
+
+	/** Commit all changed values to the collection instance of the world. Called automatically after actors have ticked. */
+	void CommitParameters();
+
+	/** Material parameter collection written by this subsystem. */
+	UMaterialParameterCollection* GetParameterCollection() const;
+
+	/** Position value used for pointers that are inactive. */
+	static const FVector InactivePointerPosition;
+
+private:
+	template <typename ValueType>
+	struct FBufferedParameter
+	{
+		FName Name;
+		ValueType Value;
+		bool bIsDirty;
+	};
+
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaTime);
+
+	/** Parameter collection used to store the pointer positions. */
+	UPROPERTY(Transient)
+	UMaterialParameterCollection* ParameterCollection;
+
+	TArray<FBufferedParameter<FLinearColor>> VectorParameters;
+	TArray<FBufferedParameter<float>> ScalarParameters;
+
+	/** Whether any parameter has been changed since the last commit. */
+	bool bHasDirtyParameters = false;
+
+	/** Vector parameter indices of the left and right pointer positions. */
+	int32 PointerPositionIndices[2] = {INDEX_NONE, INDEX_NONE};
+
+	FDelegateHandle PostActorTickHandle;
+};
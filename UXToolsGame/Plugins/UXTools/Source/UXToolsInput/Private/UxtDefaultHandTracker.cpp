@@ -107,6 +107,37 @@ bool FUxtDefaultHandTracker::IsHandController(EControllerHand Hand) const
 
 bool FUxtDefaultHandTracker::GetJointState(
 	EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
+{
+	const FUxtHandJointFilter& JointFilter = GetJointFilter(Hand);
+	if (JointFilter.HasState())
+	{
+		const int32 iJoint = (int32)Joint;
+		OutOrientation = JointFilter.GetOrientations()[iJoint];
+		OutPosition = JointFilter.GetPositions()[iJoint];
+		OutRadius = GetControllerData(Hand).HandKeyRadii[iJoint];
+		return true;
+	}
+	return GetRawJointState(Hand, Joint, OutOrientation, OutPosition, OutRadius);
+}
+
+bool FUxtDefaultHandTracker::GetAllJointStates(
+	EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions, TArrayView<float> OutRadii) const
+{
+	check(OutOrientations.Num() == EHandKeypointCount && OutPositions.Num() == EHandKeypointCount && OutRadii.Num() == EHandKeypointCount);
+
+	const FUxtHandJointFilter& JointFilter = GetJointFilter(Hand);
+	if (JointFilter.HasState())
+	{
+		FMemory::Memcpy(OutOrientations.GetData(), JointFilter.GetOrientations(), EHandKeypointCount * sizeof(FQuat));
+		FMemory::Memcpy(OutPositions.GetData(), JointFilter.GetPositions(), EHandKeypointCount * sizeof(FVector));
+		FMemory::Memcpy(OutRadii.GetData(), GetControllerData(Hand).HandKeyRadii.GetData(), EHandKeypointCount * sizeof(float));
+		return true;
+	}
+	return GetAllRawJointStates(Hand, OutOrientations, OutPositions, OutRadii);
+}
+
+bool FUxtDefaultHandTracker::GetRawJointState(
+	EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
 {
 	const FXRMotionControllerData& MotionControllerData = GetControllerData(Hand);
 	if (IsValidHandData(MotionControllerData))
@@ -120,6 +151,38 @@ bool FUxtDefaultHandTracker::GetJointState(
 	return false;
 }
 
+bool FUxtDefaultHandTracker::GetAllRawJointStates(
+	EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions, TArrayView<float> OutRadii) const
+{
+	check(OutOrientations.Num() == EHandKeypointCount && OutPositions.Num() == EHandKeypointCount && OutRadii.Num() == EHandKeypointCount);
+
+	const FXRMotionControllerData& MotionControllerData = GetControllerData(Hand);
+	if (IsValidHandData(MotionControllerData))
+	{
+		FMemory::Memcpy(OutOrientations.GetData(), MotionControllerData.HandKeyRotations.GetData(), EHandKeypointCount * sizeof(FQuat));
+		FMemory::Memcpy(OutPositions.GetData(), MotionControllerData.HandKeyPositions.GetData(), EHandKeypointCount * sizeof(FVector));
+		FMemory::Memcpy(OutRadii.GetData(), MotionControllerData.HandKeyRadii.GetData(), EHandKeypointCount * sizeof(float));
+		return true;
+	}
+	return false;
+}
+
+void FUxtDefaultHandTracker::SetJointFilterSettings(const FUxtHandJointFilterSettings& Settings)
+{
+	JointFilterSettings = Settings;
+
+	if (!JointFilterSettings.bEnabled)
+	{
+		JointFilter_Left.Reset();
+		JointFilter_Right.Reset();
+	}
+}
+
+const FUxtHandJointFilterSettings& FUxtDefaultHandTracker::GetJointFilterSettings() const
+{
+	return JointFilterSettings;
+}
+
 bool FUxtDefaultHandTracker::GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
 {
 	const FXRMotionControllerData& MotionControllerData = GetControllerData(Hand);
@@ -171,3 +234,75 @@ bool FUxtDefaultHandTracker::GetIsSelectPressed(EControllerHand Hand, bool& OutI
 	}
 	return false;
 }
+
+const FUxtHandFrame& FUxtDefaultHandTracker::GetHandFrame(EControllerHand Hand) const
+{
+	return HandFrameCache.GetHandFrame(*this, Hand);
+}
+
+const FUxtHandHistory& FUxtDefaultHandTracker::GetHandHistory(EControllerHand Hand) const
+{
+	return HandFrameCache.GetHandHistory(*this, Hand);
+}
+
+void FUxtDefaultHandTracker::SetPredictionSettings(const FUxtHandPredictionSettings& Settings)
+{
+	HandFrameCache.SetPredictionSettings(Settings);
+}
+
+const FUxtHandPredictionSettings& FUxtDefaultHandTracker::GetPredictionSettings() const
+{
+	return HandFrameCache.GetPredictionSettings();
+}
+
+bool FUxtDefaultHandTracker::GetPredictedJointState(
+	EControllerHand Hand, EHandKeypoint Joint, double TargetTime, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
+{
+	return HandFrameCache.GetPredictedJointState(*this, Hand, Joint, TargetTime, OutOrientation, OutPosition, OutRadius);
+}
+
+bool FUxtDefaultHandTracker::GetPredictedPointerPose(
+	EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return HandFrameCache.GetPredictedPointerPose(*this, Hand, TargetTime, OutOrientation, OutPosition);
+}
+
+bool FUxtDefaultHandTracker::GetPredictedGripPose(
+	EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return HandFrameCache.GetPredictedGripPose(*this, Hand, TargetTime, OutOrientation, OutPosition);
+}
+
+void FUxtDefaultHandTracker::Update(float DeltaTime)
+{
+	UpdateJointFilters(DeltaTime);
+
+	// Derive the hand frames from the new data before any actor ticks
+	HandFrameCache.Update(*this);
+}
+
+void FUxtDefaultHandTracker::UpdateJointFilters(float DeltaTime)
+{
+	for (const EControllerHand Hand : {EControllerHand::Left, EControllerHand::Right})
+	{
+		FUxtHandJointFilter& JointFilter = Hand == EControllerHand::Left ? JointFilter_Left : JointFilter_Right;
+		const FXRMotionControllerData& MotionControllerData = GetControllerData(Hand);
+
+		// Start over when the hand is found again, filtering towards stale joints would drag the hand across the scene
+		if (JointFilterSettings.bEnabled && IsValidHandData(MotionControllerData))
+		{
+			JointFilter.Update(
+				MotionControllerData.HandKeyRotations.GetData(), MotionControllerData.HandKeyPositions.GetData(), DeltaTime,
+				JointFilterSettings);
+		}
+		else
+		{
+			JointFilter.Reset();
+		}
+	}
+}
+
+const FUxtHandJointFilter& FUxtDefaultHandTracker::GetJointFilter(EControllerHand Hand) const
+{
+	return Hand == EControllerHand::Left ? JointFilter_Left : JointFilter_Right;
+}
@@ -157,6 +157,13 @@ void UUxtDefaultHandTrackerSubsystem::OnWorldPreActorTick(UWorld* World, ELevelT
 		// Disable head pose override from simulation
 		UUxtFunctionLibrary::bUseInputSim = false;
 	}
+
+	// Worlds tick separately, only advance the filters once per frame
+	if (TrackerUpdateFrame != GFrameCounter)
+	{
+		TrackerUpdateFrame = GFrameCounter;
+		DefaultHandTracker.Update(DeltaTime);
+	}
 }
 
 void UUxtDefaultHandTrackerSubsystem::OnLeftSelectPressed()
@@ -46,6 +46,9 @@ private:
 private:
 	FUxtDefaultHandTracker DefaultHandTracker;
 
+	/** Frame counter at which the default hand tracker has been updated. */
+	uint64 TrackerUpdateFrame = MAX_uint64;
+
 	FDelegateHandle TickDelegateHandle;
 
 	FDelegateHandle PostLoginHandle;
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "HeadMountedDisplayTypes.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+#include "HandTracking/UxtHandFrameCache.h"
+
+class AXRSimulationActor;
+struct FXRSimulationState;
+
+namespace UxtHandTrackerInputActions
+{
+	static const FName LeftSelect = TEXT("UxtLeftSelect");
+	static const FName LeftGrab = TEXT("UxtLeftGrab");
+	static const FName RightSelect = TEXT("UxtRightSelect");
+	static const FName RightGrab = TEXT("UxtRightGrab");
+} // namespace UxtHandTrackerInputActions
+
+/** Default hand tracker implementation.
+ *
+ * This implementation works for all XR systems. It uses the XRTrackingSystem engine API.
+ * Hand and controller data is based on the FXRMotionControllerData.
+ *
+ * Motion controller data is cached at the beginning of each frame.
+ * Input events for known XR systems are used to keep track of Select and Grip actions.
+ * If enabled, hand joints are filtered once after caching and reported filtered, the raw joints remain available.
+ */
+class UXTOOLSINPUT_API FUxtDefaultHandTracker : public IUxtHandTracker
+{
+public:
+	static void RegisterInputMappings();
+	static void UnregisterInputMappings();
+
+	FXRMotionControllerData& GetControllerData(EControllerHand Hand);
+	const FXRMotionControllerData& GetControllerData(EControllerHand Hand) const;
+
+	/** Filter the joints of the cached controller data and capture the hand frames, call once per frame after caching. */
+	void Update(float DeltaTime);
+
+	//
+	// IUxtHandTracker interface
+
+	virtual ETrackingStatus GetTrackingStatus(EControllerHand Hand) const override;
+	virtual bool IsHandController(EControllerHand Hand) const override;
+	virtual bool GetJointState(
+		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const override;
+	virtual bool GetAllJointStates(
+		EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions,
+		TArrayView<float> OutRadii) const override;
+	virtual bool GetRawJointState(
+		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const override;
+	virtual bool GetAllRawJointStates(
+		EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions,
+		TArrayView<float> OutRadii) const override;
+	virtual void SetJointFilterSettings(const FUxtHandJointFilterSettings& Settings) override;
+	virtual const FUxtHandJointFilterSettings& GetJointFilterSettings() const override;
+	virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const override;
+	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override;
+	virtual const FUxtHandFrame& GetHandFrame(EControllerHand Hand) const override;
+	virtual const FUxtHandHistory& GetHandHistory(EControllerHand Hand) const override;
+	virtual void SetPredictionSettings(const FUxtHandPredictionSettings& Settings) override;
+	virtual const FUxtHandPredictionSettings& GetPredictionSettings() const override;
+	virtual bool GetPredictedJointState(
+		EControllerHand Hand, EHandKeypoint Joint, double TargetTime, FQuat& OutOrientation, FVector& OutPosition,
+		float& OutRadius) const override;
+	virtual bool GetPredictedPointerPose(
+		EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetPredictedGripPose(
+		EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const override;
+
+private:
+	/** Filter the joints of the cached controller data. */
+	void UpdateJointFilters(float DeltaTime);
+
+	const FUxtHandJointFilter& GetJointFilter(EControllerHand Hand) const;
+
+	FXRMotionControllerData ControllerData_Left;
+	FXRMotionControllerData ControllerData_Right;
+	bool bIsGrabbing_Left = false;
+	bool bIsSelectPressed_Left = false;
+	bool bIsGrabbing_Right = false;
+	bool bIsSelectPressed_Right = false;
+
+	FUxtHandJointFilterSettings JointFilterSettings;
+	FUxtHandJointFilter JointFilter_Left;
+	FUxtHandJointFilter JointFilter_Right;
+
+	/** Hand frames and histories captured from the cached data, frames are captured on demand by const accessors. */
+	mutable FUxtHandFrameCache HandFrameCache;
+
+	friend class UUxtDefaultHandTrackerSubsystem;
+};
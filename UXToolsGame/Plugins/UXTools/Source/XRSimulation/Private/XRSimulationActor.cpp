@@ -99,10 +99,15 @@ namespace
 		for (int32 iKeypoint = 0; iKeypoint < EHandKeypointCount; ++iKeypoint)
 		{
 			Result[iKeypoint] = (EHandKeypoint)KeypointEnum->GetValueByIndex(iKeypoint);
+			check((int32)Result[iKeypoint] == iKeypoint);
 		}
 
 		return Result;
 	}
+
+	/** Radius reported for all keypoints. */
+	// TODO What skeletal mesh property could be used for the radius?
+	const float KeypointRadius = 1.0f;
 } // namespace
 
 AXRSimulationActor::AXRSimulationActor(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -167,7 +172,6 @@ void AXRSimulationActor::GetHandData(EControllerHand Hand, FXRMotionControllerDa
 	check(Settings);
 
 	USkeletalMeshComponent* MeshComp = GetHandMesh(Hand);
-	const UEnum* KeypointEnum = StaticEnum<EHandKeypoint>();
 
 	if (!SimulationState.IsValid() || !ensureAsRuntimeWarning(MeshComp != nullptr))
 	{
@@ -188,29 +192,25 @@ void AXRSimulationActor::GetHandData(EControllerHand Hand, FXRMotionControllerDa
 
 	if (!bIsTracked)
 	{
-		// When untracked the keypoint arrays should be empty
-		MotionControllerData.HandKeyPositions.Empty();
-		MotionControllerData.HandKeyRotations.Empty();
-		MotionControllerData.HandKeyRadii.Empty();
+		// When untracked the keypoint arrays should be empty, keep the allocation for when tracking resumes
+		MotionControllerData.HandKeyPositions.Reset();
+		MotionControllerData.HandKeyRotations.Reset();
+		MotionControllerData.HandKeyRadii.Reset();
 	}
 	else
 	{
-		MotionControllerData.HandKeyPositions.SetNum(EHandKeypointCount);
-		MotionControllerData.HandKeyRotations.SetNum(EHandKeypointCount);
-		MotionControllerData.HandKeyRadii.SetNum(EHandKeypointCount);
+		MotionControllerData.HandKeyPositions.SetNumUninitialized(EHandKeypointCount, false);
+		MotionControllerData.HandKeyRotations.SetNumUninitialized(EHandKeypointCount, false);
+		MotionControllerData.HandKeyRadii.SetNumUninitialized(EHandKeypointCount, false);
 
 		// Get keypoint transforms for all hand joints
 		static const TArray<EHandKeypoint> AllKeypoints = BuildHandKeypointList();
-		TArray<FTransform> AllKeypointTransforms;
-		TArray<float> AllKeypointRadii;
-		GetKeypointTransforms(Hand, AllKeypoints, AllKeypointTransforms, AllKeypointRadii);
+		FTransform AllKeypointTransforms[EHandKeypointCount];
+		GetKeypointTransforms(Hand, AllKeypoints, AllKeypointTransforms);
 
 		for (int32 i = 0; i < EHandKeypointCount; ++i)
 		{
-			const EHandKeypoint Keypoint = (EHandKeypoint)KeypointEnum->GetValueByIndex(i);
-			check(AllKeypoints[i] == Keypoint);
 			const FTransform& KeypointTransform = AllKeypointTransforms[i];
-			const float KeypointRadius = AllKeypointRadii[i];
 
 			MotionControllerData.HandKeyPositions[i] = KeypointTransform.GetLocation();
 			MotionControllerData.HandKeyRotations[i] = KeypointTransform.GetRotation();
@@ -560,44 +560,55 @@ void AXRSimulationActor::OnHandRotateReleased()
 	}
 }
 
+const AXRSimulationActor::FKeypointBoneTable& AXRSimulationActor::GetKeypointBoneTable(
+	EControllerHand Hand, const USkeletalMeshComponent* MeshComp) const
+{
+	FKeypointBoneTable& Table = (Hand == EControllerHand::Left ? LeftKeypointBones : RightKeypointBones);
+
+	const USkeletalMesh* SkeletalMesh = MeshComp->SkeletalMesh;
+	if (Table.SkeletalMesh.Get() != SkeletalMesh || !Table.SkeletalMesh.IsValid())
+	{
+		const UEnum* KeypointEnum = StaticEnum<EHandKeypoint>();
+
+		Table.SkeletalMesh = SkeletalMesh;
+		for (int32 iKeypoint = 0; iKeypoint < EHandKeypointCount; ++iKeypoint)
+		{
+			const FName KeypointName = FName(*KeypointEnum->GetNameStringByValue(iKeypoint));
+			Table.BoneIndices[iKeypoint] = SkeletalMesh ? MeshComp->GetBoneIndex(KeypointName) : INDEX_NONE;
+		}
+	}
+
+	return Table;
+}
+
 bool AXRSimulationActor::GetKeypointTransforms(
-	EControllerHand Hand, const TArray<EHandKeypoint>& Keypoints, TArray<FTransform>& OutTransforms, TArray<float>& OutRadii) const
+	EControllerHand Hand, TArrayView<const EHandKeypoint> Keypoints, TArrayView<FTransform> OutTransforms) const
 {
-	const UEnum* KeypointEnum = StaticEnum<EHandKeypoint>();
+	check(Keypoints.Num() == OutTransforms.Num());
+
 	USkeletalMeshComponent* MeshComp = GetHandMesh(Hand);
 	if (!ensureAsRuntimeWarning(MeshComp != nullptr))
 	{
 		return false;
 	}
 
-	TArray<FName> BoneNames;
-	MeshComp->GetBoneNames(BoneNames);
+	const FKeypointBoneTable& BoneTable = GetKeypointBoneTable(Hand, MeshComp);
 	const TArray<FTransform>& ComponentSpaceTMs = MeshComp->GetComponentSpaceTransforms();
+	const FTransform& ComponentTransform = MeshComp->GetComponentTransform();
 
-	OutTransforms.Reset(Keypoints.Num());
-	OutRadii.Reset(Keypoints.Num());
-	for (EHandKeypoint Keypoint : Keypoints)
+	for (int32 i = 0; i < Keypoints.Num(); ++i)
 	{
-		FName KeypointName = FName(*KeypointEnum->GetNameStringByValue((int64)Keypoint));
+		const int32 BoneIndex = BoneTable.BoneIndices[(int32)Keypoints[i]];
 
-		int32 KeypointPoseIndex;
-		FTransform KeypointTransform;
-		if (BoneNames.Find(KeypointName, KeypointPoseIndex))
+		FTransform& KeypointTransform = OutTransforms[i];
+		if (ComponentSpaceTMs.IsValidIndex(BoneIndex))
 		{
-			KeypointTransform = ComponentSpaceTMs[KeypointPoseIndex];
+			FTransform::Multiply(&KeypointTransform, &ComponentSpaceTMs[BoneIndex], &ComponentTransform);
 		}
 		else
 		{
-			KeypointTransform.SetIdentity();
+			KeypointTransform = ComponentTransform;
 		}
-
-		FTransform::Multiply(&KeypointTransform, &KeypointTransform, &MeshComp->GetComponentTransform());
-
-		// TODO What skeletal mesh property could be used for the radius?
-		float KeypointRadius = 1.0f;
-
-		OutTransforms.Add(KeypointTransform);
-		OutRadii.Add(KeypointRadius);
 	}
 
 	return true;
@@ -615,12 +626,12 @@ void AXRSimulationActor::UpdateStabilizedGripTransform(EControllerHand Hand)
 		if (bGrip && !bGripFrozen)
 		{
 			// Freeze grip transform
-			TArray<FTransform> KeypointTransforms;
-			TArray<float> KeypointRadii;
-			if (GetKeypointTransforms(Hand, {EHandKeypoint::Palm, EHandKeypoint::Wrist}, KeypointTransforms, KeypointRadii))
+			const EHandKeypoint GripKeypoints[] = {EHandKeypoint::Palm, EHandKeypoint::Wrist};
+			FTransform KeypointTransforms[UE_ARRAY_COUNT(GripKeypoints)];
+			if (GetKeypointTransforms(Hand, GripKeypoints, KeypointTransforms))
 			{
-				const FTransform& PalmTransform = KeypointTransforms[(int32)EHandKeypoint::Palm];
-				const FTransform& WristTransform = KeypointTransforms[(int32)EHandKeypoint::Wrist];
+				const FTransform& PalmTransform = KeypointTransforms[0];
+				const FTransform& WristTransform = KeypointTransforms[1];
 				SimulationState->SetGripToWristTransform(Hand, PalmTransform.GetRelativeTransform(WristTransform));
 			}
 		}
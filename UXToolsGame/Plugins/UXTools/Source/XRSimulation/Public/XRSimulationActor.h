@@ -13,6 +13,8 @@
 
 struct FXRMotionControllerData;
 class UXRSimulationHeadMovementComponent;
+class USkeletalMesh;
+class USkeletalMeshComponent;
 
 /** Actor that produces head pose and hand animations for the simulated HMD. */
 UCLASS(ClassGroup = "XRSimulation")
@@ -52,9 +54,24 @@ public:
 	static void UnregisterInputMappings();
 
 private:
-	/** Find bone transforms matching the requested keypoints in the skeletal hand mesh. */
-	bool GetKeypointTransforms(
-		EControllerHand Hand, const TArray<EHandKeypoint>& Keypoints, TArray<FTransform>& OutTransforms, TArray<float>& OutRadii) const;
+	/** Bone index of each keypoint in a hand mesh, indexed by EHandKeypoint. */
+	struct FKeypointBoneTable
+	{
+		/** Skeletal mesh the bone indices have been built for. */
+		TWeakObjectPtr<const USkeletalMesh> SkeletalMesh;
+
+		/** Bone index of each keypoint, INDEX_NONE if the mesh has no matching bone. */
+		int32 BoneIndices[EHandKeypointCount];
+	};
+
+	/** Returns the keypoint bone table for the given hand mesh, rebuilding it if the skeletal mesh has changed. */
+	const FKeypointBoneTable& GetKeypointBoneTable(EControllerHand Hand, const USkeletalMeshComponent* MeshComp) const;
+
+	/**
+	 * Find bone transforms matching the requested keypoints in the skeletal hand mesh.
+	 * The output array must have the same number of elements as the keypoint list.
+	 */
+	bool GetKeypointTransforms(EControllerHand Hand, TArrayView<const EHandKeypoint> Keypoints, TArrayView<FTransform> OutTransforms) const;
 
 	/** Set or clear the GripToWristTransform when grip starts or stops. */
 	void UpdateStabilizedGripTransform(EControllerHand Hand);
@@ -126,4 +143,10 @@ private:
 	 * This transform is applied in parent space to the hand component transforms.
 	 */
 	FTransform TrackingToWorldTransform = FTransform::Identity;
+
+	/** Keypoint bone indices of the left hand mesh, built when the mesh is first queried or changed. */
+	mutable FKeypointBoneTable LeftKeypointBones;
+
+	/** Keypoint bone indices of the right hand mesh, built when the mesh is first queried or changed. */
+	mutable FKeypointBoneTable RightKeypointBones;
 };
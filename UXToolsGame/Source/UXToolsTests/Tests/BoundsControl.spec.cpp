@@ -8,12 +8,14 @@
 #include "UxtTestHandTracker.h"
 #include "UxtTestUtils.h"
 
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Controls/UxtBoundsControlComponent.h"
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Interactions/Constraints/UxtMoveAxisConstraint.h"
 #include "Interactions/Constraints/UxtRotationAxisConstraint.h"
 #include "Interactions/UxtGenericManipulatorComponent.h"
+#include "Materials/Material.h"
 #include "Tests/AutomationCommon.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -23,7 +25,7 @@ namespace
 	const FVector TargetLocation(150, 0, 0);
 	const FVector InitialPointerOffset(0, 200, 0); // Offset to avoid pointing at the target before test starts
 
-	UUxtBoundsControlComponent* CreateTestComponent()
+	UUxtBoundsControlComponent* CreateTestComponent(bool bUseInstancedAffordances = false, bool bWithInstancedMaterial = true)
 	{
 		UWorld* World = UxtTestUtils::GetTestWorld();
 		AActor* Actor = World->SpawnActor<AActor>();
@@ -44,6 +46,11 @@ namespace
 		UUxtBoundsControlComponent* BoundsControl = NewObject<UUxtBoundsControlComponent>(Actor);
 		BoundsControl->Config =
 			Cast<UUxtBoundsControlConfig>(StaticLoadObject(UUxtBoundsControlConfig::StaticClass(), NULL, *BoundsControlPresetName));
+		BoundsControl->bUseInstancedAffordances = bUseInstancedAffordances;
+		if (bWithInstancedMaterial)
+		{
+			BoundsControl->InstancedAffordanceMaterial = UMaterial::GetDefaultMaterial(MD_Surface);
+		}
 		BoundsControl->RegisterComponent();
 
 		Actor->SetActorLocation(TargetLocation);
@@ -59,6 +66,26 @@ namespace
 		return BoundsControl->GetPrimitiveAffordanceMap().Find(Primitive);
 	}
 
+	const FUxtAffordanceInstance* GetInstancedAffordance(UUxtBoundsControlComponent* BoundsControl, EUxtAffordancePlacement Placement)
+	{
+		return BoundsControl->GetInstancedAffordances().FindByPredicate([Placement](const FUxtAffordanceInstance& AffordanceInstance)
+																		   { return AffordanceInstance.Config.Placement == Placement; });
+	}
+
+	/** Hidden instances are scaled to zero */
+	bool IsInstanceVisible(const FUxtAffordanceInstance* AffordanceInstance)
+	{
+		FTransform InstanceTransform;
+		AffordanceInstance->InstancedMesh->GetInstanceTransform(AffordanceInstance->InstanceIndex, InstanceTransform);
+		return !InstanceTransform.GetScale3D().IsNearlyZero();
+	}
+
+	float GetInstanceCustomData(const FUxtAffordanceInstance* AffordanceInstance, int32 DataIndex)
+	{
+		const UInstancedStaticMeshComponent* InstancedMesh = AffordanceInstance->InstancedMesh;
+		return InstancedMesh->PerInstanceSMCustomData[AffordanceInstance->InstanceIndex * InstancedMesh->NumCustomDataFloats + DataIndex];
+	}
+
 	UPrimitiveComponent* GetFocusedPrimitive(FUxtTestHand Hand)
 	{
 		UUxtPointerComponent* Pointer = Hand.GetPointer();
@@ -740,6 +767,123 @@ void BoundsControlSpec::EnqueueTransformationsTest()
 						});
 				});
 		});
+
+	Describe(
+		"Instanced affordances",
+		[this]
+		{
+			LatentIt(
+				"should place one instance per affordance",
+				[this](const FDoneDelegate& Done)
+				{
+					UUxtBoundsControlComponent* InstancedTarget = CreateTestComponent(/* bUseInstancedAffordances = */ true);
+
+					TestEqual("No affordance primitives", InstancedTarget->GetPrimitiveAffordanceMap().Num(), 0);
+					TestEqual(
+						"One instance per affordance", InstancedTarget->GetInstancedAffordances().Num(),
+						InstancedTarget->Config->Affordances.Num());
+
+					TSet<UInstancedStaticMeshComponent*> InstancedMeshes;
+					int32 NumInstances = 0;
+					for (const FUxtAffordanceInstance& AffordanceInstance : InstancedTarget->GetInstancedAffordances())
+					{
+						TestNotNull("Affordance has an instanced mesh", AffordanceInstance.InstancedMesh);
+						if (AffordanceInstance.InstancedMesh && !InstancedMeshes.Contains(AffordanceInstance.InstancedMesh))
+						{
+							InstancedMeshes.Add(AffordanceInstance.InstancedMesh);
+							NumInstances += AffordanceInstance.InstancedMesh->GetInstanceCount();
+						}
+					}
+					TSet<EUxtAffordanceKind> AffordanceKinds;
+					for (const FUxtAffordanceConfig& AffordanceConfig : InstancedTarget->Config->Affordances)
+					{
+						AffordanceKinds.Add(AffordanceConfig.GetAffordanceKind());
+					}
+					TestEqual("One mesh per affordance kind", InstancedMeshes.Num(), AffordanceKinds.Num());
+					TestEqual("Number of instances", NumInstances, InstancedTarget->Config->Affordances.Num());
+
+					FrameQueue.Skip();
+					FrameQueue.Enqueue(
+						[this, InstancedTarget, Done]
+						{
+							// Both targets share the same mesh and location, so affordances must match
+							for (const FUxtAffordanceInstance& AffordanceInstance : InstancedTarget->GetInstancedAffordances())
+							{
+								const UPrimitiveComponent* Primitive = Target->GetAffordancePrimitive(AffordanceInstance.Config.Placement);
+								TestEqual("Instance location", AffordanceInstance.Location, Primitive->GetComponentLocation());
+
+								FTransform InstanceTransform;
+								AffordanceInstance.InstancedMesh->GetInstanceTransform(
+									AffordanceInstance.InstanceIndex, InstanceTransform, /* bWorldSpace = */ true);
+								TestEqual("Instance transform", InstanceTransform.GetLocation(), Primitive->GetComponentLocation());
+							}
+
+							InstancedTarget->GetOwner()->Destroy();
+							Done.Execute();
+						});
+				});
+
+			It("should use affordance meshes without an instanced material",
+			   [this]
+			   {
+				   UUxtBoundsControlComponent* InstancedTarget =
+					   CreateTestComponent(/* bUseInstancedAffordances = */ true, /* bWithInstancedMaterial = */ false);
+
+				   TestEqual(
+					   "One primitive per affordance", InstancedTarget->GetPrimitiveAffordanceMap().Num(),
+					   InstancedTarget->Config->Affordances.Num());
+				   TestEqual("No instanced affordances", InstancedTarget->GetInstancedAffordances().Num(), 0);
+
+				   InstancedTarget->GetOwner()->Destroy();
+			   });
+
+			LatentIt(
+				"should only show and highlight instances near the pointer",
+				[this](const FDoneDelegate& Done)
+				{
+					// Keep the other target from taking focus, both targets are at the same location
+					Actor->SetActorEnableCollision(false);
+					Target->GetBoundsControlActor()->SetActorEnableCollision(false);
+
+					UUxtBoundsControlComponent* InstancedTarget = CreateTestComponent(/* bUseInstancedAffordances = */ true);
+					InstancedTarget->AffordanceTransitionDuration = 0.01f;
+
+					FrameQueue.Skip();
+					FrameQueue.Enqueue(
+						[this, InstancedTarget]
+						{
+							for (const FUxtAffordanceInstance& AffordanceInstance : InstancedTarget->GetInstancedAffordances())
+							{
+								TestFalse("Instance hidden beforehand", IsInstanceVisible(&AffordanceInstance));
+								TestFalse("Mesh hidden beforehand", AffordanceInstance.InstancedMesh->IsVisible());
+							}
+
+							const FUxtAffordanceInstance* Corner =
+								GetInstancedAffordance(InstancedTarget, EUxtAffordancePlacement::CornerFrontRightTop);
+							LeftHand.SetTranslation(Corner->Location, /* bApplyOffset = */ true);
+						});
+					FrameQueue.Skip(2);
+					FrameQueue.Enqueue(
+						[this, InstancedTarget, Done]
+						{
+							const FUxtAffordanceInstance* Corner =
+								GetInstancedAffordance(InstancedTarget, EUxtAffordancePlacement::CornerFrontRightTop);
+							TestTrue("Instance near the pointer visible", IsInstanceVisible(Corner));
+							TestTrue("Mesh of the instance near the pointer visible", Corner->InstancedMesh->IsVisible());
+							TestTrue("Instance near the pointer opacity", GetInstanceCustomData(Corner, 0) > 0.0f);
+							TestEqual("Instance near the pointer focus count", Corner->FocusCount, 1);
+							TestTrue("Instance near the pointer focus transition", GetInstanceCustomData(Corner, 1) > 0.0f);
+
+							const FUxtAffordanceInstance* OppositeCorner =
+								GetInstancedAffordance(InstancedTarget, EUxtAffordancePlacement::CornerBackLeftBottom);
+							TestFalse("Instance away from the pointer hidden", IsInstanceVisible(OppositeCorner));
+							TestEqual("Instance away from the pointer opacity", GetInstanceCustomData(OppositeCorner, 0), 0.0f);
+
+							InstancedTarget->GetOwner()->Destroy();
+							Done.Execute();
+						});
+				});
+		});
 }
 
 void BoundsControlSpec::EnqueueAffordanceFocusTest()
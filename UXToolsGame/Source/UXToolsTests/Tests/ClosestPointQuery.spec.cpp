@@ -0,0 +1,169 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "UxtTestUtils.h"
+
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
+#include "Interactions/UxtClosestPointQuery.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const FVector TargetLocation(150, 0, 0);
+	const FRotator TargetRotation(30, 45, 10);
+
+	/** Query points around the target, inside and outside of the collision. */
+	TArray<FVector> GetQueryPoints()
+	{
+		TArray<FVector> Points;
+		Points.Add(TargetLocation);
+		for (int32 X = -1; X <= 1; ++X)
+		{
+			for (int32 Y = -1; Y <= 1; ++Y)
+			{
+				for (int32 Z = -1; Z <= 1; ++Z)
+				{
+					Points.Add(TargetLocation + FVector(X * 70, Y * 45, Z * 20));
+					Points.Add(TargetLocation + FVector(X * 7, Y * 4, Z * 2));
+				}
+			}
+		}
+		return Points;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	ClosestPointQuerySpec, "UXTools.ClosestPointQuery", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+UWorld* World;
+AActor* Actor;
+
+void TestMatchesPhysics(UPrimitiveComponent* Primitive);
+
+END_DEFINE_SPEC(ClosestPointQuerySpec)
+
+void ClosestPointQuerySpec::TestMatchesPhysics(UPrimitiveComponent* Primitive)
+{
+	Actor->SetRootComponent(Primitive);
+	Primitive->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	Primitive->RegisterComponent();
+	Actor->SetActorLocationAndRotation(TargetLocation, TargetRotation);
+
+	TestTrue("Primitive is analytic", FUxtClosestPointQuery::IsAnalyticPrimitive(Primitive));
+
+	const TArray<FVector> Points = GetQueryPoints();
+	for (const FVector& Point : Points)
+	{
+		FVector ExpectedPoint;
+		float ExpectedDistanceSqr;
+		TestTrue("Physics query succeeds", Primitive->GetSquaredDistanceToCollision(Point, ExpectedDistanceSqr, ExpectedPoint));
+
+		FVector PointOnSurface;
+		float DistanceSqr;
+		TestTrue("Analytic query succeeds", FUxtClosestPointQuery::GetClosestPoint(Primitive, Point, PointOnSurface, DistanceSqr));
+		TestEqual("Closest point", PointOnSurface, ExpectedPoint, 0.01f);
+		TestEqual("Squared distance", DistanceSqr, ExpectedDistanceSqr, 0.1f);
+	}
+}
+
+void ClosestPointQuerySpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			World = UxtTestUtils::LoadMap("/Game/UXToolsGame/Tests/Maps/TestEmpty");
+			TestNotNull("World", World);
+
+			Actor = World->SpawnActor<AActor>();
+		});
+
+	AfterEach(
+		[this]
+		{
+			Actor->Destroy();
+			Actor = nullptr;
+			UxtTestUtils::ExitGame();
+		});
+
+	It("should match physics for boxes",
+	   [this]
+	   {
+		   UBoxComponent* Box = NewObject<UBoxComponent>(Actor);
+		   Box->SetBoxExtent(FVector(40, 20, 10));
+		   TestMatchesPhysics(Box);
+	   });
+
+	It("should match physics for spheres",
+	   [this]
+	   {
+		   USphereComponent* Sphere = NewObject<USphereComponent>(Actor);
+		   Sphere->SetSphereRadius(30);
+		   TestMatchesPhysics(Sphere);
+	   });
+
+	It("should match physics for capsules",
+	   [this]
+	   {
+		   UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Actor);
+		   Capsule->SetCapsuleSize(10, 40);
+		   TestMatchesPhysics(Capsule);
+	   });
+
+	It("should match physics for non-uniformly scaled box meshes",
+	   [this]
+	   {
+		   UStaticMeshComponent* Mesh = UxtTestUtils::CreateStaticMesh(Actor, FVector(0.8f, 0.4f, 0.2f));
+		   TestMatchesPhysics(Mesh);
+	   });
+
+	It("should return results for all primitives in a batch",
+	   [this]
+	   {
+		   USceneComponent* Root = NewObject<USceneComponent>(Actor);
+		   Actor->SetRootComponent(Root);
+		   Root->RegisterComponent();
+
+		   TArray<const UPrimitiveComponent*> Primitives;
+		   for (int32 Index = 0; Index < 6; ++Index)
+		   {
+			   UBoxComponent* Box = NewObject<UBoxComponent>(Actor);
+			   Box->SetupAttachment(Root);
+			   Box->SetBoxExtent(FVector(10));
+			   Box->SetRelativeLocation(FVector(0, Index * 30, 0));
+			   Box->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+			   Box->RegisterComponent();
+			   Primitives.Add(Box);
+		   }
+
+		   UBoxComponent* NoCollision = NewObject<UBoxComponent>(Actor);
+		   NoCollision->SetupAttachment(Root);
+		   NoCollision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		   NoCollision->RegisterComponent();
+		   Primitives.Add(NoCollision);
+
+		   const FVector Point(0, 0, 50);
+		   TArray<FVector> PointsOnSurface;
+		   TArray<float> DistancesSqr;
+		   PointsOnSurface.SetNum(Primitives.Num());
+		   DistancesSqr.SetNum(Primitives.Num());
+		   FUxtClosestPointQuery::GetClosestPoints(Primitives, Point, PointsOnSurface, DistancesSqr);
+
+		   for (int32 Index = 0; Index < 6; ++Index)
+		   {
+			   const FVector Expected(0, FMath::Max(Index * 30.0f - 10.0f, 0.0f), 10);
+			   TestEqual("Closest point", PointsOnSurface[Index], Expected, 0.01f);
+			   TestEqual("Squared distance", DistancesSqr[Index], static_cast<float>(FVector::DistSquared(Point, Expected)), 0.1f);
+		   }
+
+		   TestTrue("No point without collision", DistancesSqr.Last() < 0.0f);
+		   TestEqual("Point without collision", PointsOnSurface.Last(), Point);
+	   });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
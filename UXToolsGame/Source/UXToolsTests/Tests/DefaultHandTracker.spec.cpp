@@ -0,0 +1,122 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtDefaultHandTracker.h"
+
+#include "HandTracking/UxtHandFrame.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	DefaultHandTrackerSpec, "UXTools.DefaultHandTracker",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+TUniquePtr<FUxtDefaultHandTracker> HandTracker;
+FUxtHandJointFilterSettings Settings;
+
+void SetHandPosition(EControllerHand Hand, const FVector& Position);
+FVector GetJointPosition(EControllerHand Hand) const;
+FVector GetRawJointPosition(EControllerHand Hand) const;
+
+END_DEFINE_SPEC(DefaultHandTrackerSpec)
+
+void DefaultHandTrackerSpec::SetHandPosition(EControllerHand Hand, const FVector& Position)
+{
+	FXRMotionControllerData& ControllerData = HandTracker->GetControllerData(Hand);
+	ControllerData.bValid = true;
+	ControllerData.DeviceVisualType = EXRVisualType::Hand;
+	ControllerData.TrackingStatus = ETrackingStatus::Tracked;
+	ControllerData.HandKeyRotations.Init(FQuat::Identity, EHandKeypointCount);
+	ControllerData.HandKeyPositions.Init(Position, EHandKeypointCount);
+	ControllerData.HandKeyRadii.Init(1.0f, EHandKeypointCount);
+}
+
+FVector DefaultHandTrackerSpec::GetJointPosition(EControllerHand Hand) const
+{
+	FQuat Orientation;
+	FVector Position = FVector::ZeroVector;
+	float Radius;
+	HandTracker->GetJointState(Hand, EHandKeypoint::IndexTip, Orientation, Position, Radius);
+	return Position;
+}
+
+FVector DefaultHandTrackerSpec::GetRawJointPosition(EControllerHand Hand) const
+{
+	FQuat Orientation;
+	FVector Position = FVector::ZeroVector;
+	float Radius;
+	HandTracker->GetRawJointState(Hand, EHandKeypoint::IndexTip, Orientation, Position, Radius);
+	return Position;
+}
+
+void DefaultHandTrackerSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			HandTracker = MakeUnique<FUxtDefaultHandTracker>();
+
+			Settings = FUxtHandJointFilterSettings();
+			Settings.bEnabled = true;
+			HandTracker->SetJointFilterSettings(Settings);
+
+			// First update initializes the filters with the raw joints
+			SetHandPosition(EControllerHand::Left, FVector::ZeroVector);
+			SetHandPosition(EControllerHand::Right, FVector::ZeroVector);
+			HandTracker->Update(1.0f / 60.0f);
+
+			SetHandPosition(EControllerHand::Left, FVector(10, 0, 0));
+			SetHandPosition(EControllerHand::Right, FVector(0, 10, 0));
+			HandTracker->Update(1.0f / 60.0f);
+		});
+
+	AfterEach([this] { HandTracker.Reset(); });
+
+	It("should report filtered and raw joints separately",
+	   [this]
+	   {
+		   TestEqual("Left raw position", GetRawJointPosition(EControllerHand::Left), FVector(10, 0, 0));
+		   TestEqual("Right raw position", GetRawJointPosition(EControllerHand::Right), FVector(0, 10, 0));
+
+		   const FVector LeftPosition = GetJointPosition(EControllerHand::Left);
+		   const FVector RightPosition = GetJointPosition(EControllerHand::Right);
+		   TestTrue("Left position is filtered", LeftPosition.X > 0.0f && LeftPosition.X < 10.0f);
+		   TestTrue("Right position is filtered", RightPosition.Y > 0.0f && RightPosition.Y < 10.0f);
+	   });
+
+	It("should capture filtered joints in the hand frames",
+	   [this]
+	   {
+		   for (const EControllerHand Hand : {EControllerHand::Left, EControllerHand::Right})
+		   {
+			   const FUxtHandFrame& HandFrame = HandTracker->GetHandFrame(Hand);
+			   TestTrue("Hand frame has joints", HandFrame.HasJoints());
+			   TestEqual("Hand frame position", HandFrame.GetJointPosition(EHandKeypoint::IndexTip), GetJointPosition(Hand));
+			   TestNotEqual("Hand frame raw position", HandFrame.GetJointPosition(EHandKeypoint::IndexTip), GetRawJointPosition(Hand));
+		   }
+	   });
+
+	It("should reset both filters when filtering is disabled",
+	   [this]
+	   {
+		   Settings.bEnabled = false;
+		   HandTracker->SetJointFilterSettings(Settings);
+
+		   TestEqual("Left position", GetJointPosition(EControllerHand::Left), FVector(10, 0, 0));
+		   TestEqual("Right position", GetJointPosition(EControllerHand::Right), FVector(0, 10, 0));
+
+		   // Filters start over from the raw joints rather than the stale filtered joints
+		   Settings.bEnabled = true;
+		   HandTracker->SetJointFilterSettings(Settings);
+		   SetHandPosition(EControllerHand::Left, FVector(20, 0, 0));
+		   SetHandPosition(EControllerHand::Right, FVector(0, 20, 0));
+		   HandTracker->Update(1.0f / 60.0f);
+
+		   TestEqual("Left position after enabling", GetJointPosition(EControllerHand::Left), FVector(20, 0, 0));
+		   TestEqual("Right position after enabling", GetJointPosition(EControllerHand::Right), FVector(0, 20, 0));
+	   });
+}
+
+#endif
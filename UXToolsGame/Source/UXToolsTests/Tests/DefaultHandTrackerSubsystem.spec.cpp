@@ -0,0 +1,98 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "UxtAllocationCounter.h"
+#include "UxtTestUtils.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+#include "Misc/AutomationTest.h"
+#include "Utils/UxtFunctionLibrary.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	DefaultHandTrackerSubsystemSpec, "UXTools.DefaultHandTrackerSubsystem",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+UWorld* World;
+FUxtHandJointFilterSettings OriginalJointFilterSettings;
+FUxtHandPredictionSettings OriginalPredictionSettings;
+
+const int32 NumWarmUpFrames = 10;
+const int32 NumFrames = 100;
+
+void TickPreActor();
+
+END_DEFINE_SPEC(DefaultHandTrackerSubsystemSpec)
+
+void DefaultHandTrackerSubsystemSpec::TickPreActor()
+{
+	// Advance the frame counter like the engine loop does, the tracker only updates once per frame
+	++GFrameCounter;
+	FWorldDelegates::OnWorldPreActorTick.Broadcast(World, LEVELTICK_All, 1.0f / 60.0f);
+}
+
+void DefaultHandTrackerSubsystemSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			World = UxtTestUtils::LoadMap("/Game/UXToolsGame/Tests/Maps/TestEmpty");
+			TestNotNull("World", World);
+
+			// Run the filter and prediction stages as well
+			IUxtHandTracker& HandTracker = IUxtHandTracker::Get();
+			OriginalJointFilterSettings = HandTracker.GetJointFilterSettings();
+			OriginalPredictionSettings = HandTracker.GetPredictionSettings();
+
+			FUxtHandJointFilterSettings JointFilterSettings;
+			JointFilterSettings.bEnabled = true;
+			HandTracker.SetJointFilterSettings(JointFilterSettings);
+
+			FUxtHandPredictionSettings PredictionSettings;
+			PredictionSettings.bEnabled = true;
+			HandTracker.SetPredictionSettings(PredictionSettings);
+		});
+
+	AfterEach(
+		[this]
+		{
+			IUxtHandTracker& HandTracker = IUxtHandTracker::Get();
+			HandTracker.SetJointFilterSettings(OriginalJointFilterSettings);
+			HandTracker.SetPredictionSettings(OriginalPredictionSettings);
+
+			UxtTestUtils::ExitGame();
+			World = nullptr;
+		});
+
+	It("should not allocate when updating from the XR simulation",
+	   [this]
+	   {
+		   // Controller data arrays, filters and histories reach their final size in the first frames
+		   for (int32 Frame = 0; Frame < NumWarmUpFrames; ++Frame)
+		   {
+			   TickPreActor();
+		   }
+
+		   IUxtHandTracker& HandTracker = IUxtHandTracker::Get();
+		   TestTrue("XR simulation is used", UUxtFunctionLibrary::bUseInputSim);
+		   TestTrue("Left hand has joints", HandTracker.GetHandFrame(EControllerHand::Left).HasJoints());
+		   TestTrue("Right hand has joints", HandTracker.GetHandFrame(EControllerHand::Right).HasJoints());
+
+		   // Frames share the application time, so history samples replace each other instead of filling the ring buffer
+		   FUxtAllocationCounter AllocationCounter;
+		   AllocationCounter.Start();
+		   for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		   {
+			   TickPreActor();
+		   }
+		   AllocationCounter.Stop();
+
+		   TestEqual("Allocations", AllocationCounter.GetNumAllocations(), 0);
+		   TestEqual("Allocated bytes", AllocationCounter.GetNumBytes(), (int64)0);
+	   });
+}
+
+#endif
@@ -226,6 +226,248 @@ void FFarPointerSpec::Define()
 		   TestEqual("Hit Point", Pointer->GetHitPoint(), TargetLocation - FVector(50, 0, 0));
 	   });
 
+	LatentIt(
+		"should report correct hit info when reusing ray queries",
+		[this](const FDoneDelegate& Done)
+		{
+			Pointer->bReuseRayQuery = true;
+
+			FrameQueue.Enqueue([this]() { HandTracker->SetAllJointPositions(FVector(0, 1, 0)); });
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					// Moved less than the margin, candidates of the previous query are traced
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					TestEqual("Hit Normal", Pointer->GetHitNormal(), FVector(-1, 0, 0));
+					TestEqual("Hit Point", Pointer->GetHitPoint(), TargetLocation - FVector(50, -1, 0));
+					HandTracker->SetAllJointPositions(FVector(-500, 0, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this, Done]()
+				{
+					TestNull("Hit Primitive", Pointer->GetHitPrimitive());
+					Done.Execute();
+				});
+		});
+
+	LatentIt(
+		"should report correct hit info when using async ray queries",
+		[this](const FDoneDelegate& Done)
+		{
+			Pointer->bUseAsyncRayQuery = true;
+
+			// Let the results of the first async query be consumed
+			FrameQueue.Skip();
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					TestEqual("Hit Point", Pointer->GetHitPoint(), TargetLocation - FVector(50, 0, 0));
+					HandTracker->SetAllJointPositions(FVector(0, 1, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					TestEqual("Hit Point", Pointer->GetHitPoint(), TargetLocation - FVector(50, -1, 0));
+
+					// Move beyond the margin, results of the previous query must not be used
+					HandTracker->SetAllJointPositions(FVector(0, 200, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this, Done]()
+				{
+					TestNull("Hit Primitive", Pointer->GetHitPrimitive());
+					Done.Execute();
+				});
+		});
+
+	LatentIt(
+		"should report the same hits for batched and individual ray queries",
+		[this](const FDoneDelegate& Done)
+		{
+			Pointer->bUseBatchedRayQuery = true;
+
+			// Second pointer on the other hand, tracing its ray by itself
+			UUxtFarPointerComponent* OtherPointer = NewObject<UUxtFarPointerComponent>(Pointer->GetOwner());
+			OtherPointer->Hand = EControllerHand::Left;
+			OtherPointer->bUseBatchedRayQuery = false;
+			OtherPointer->RegisterComponent();
+
+			FrameQueue.Enqueue(
+				[this, OtherPointer]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					TestEqual("Other Hit Primitive", OtherPointer->GetHitPrimitive(), HitPrimitive);
+					TestEqual("Hit Point", Pointer->GetHitPoint(), OtherPointer->GetHitPoint());
+					TestEqual("Other Focus Target", OtherPointer->GetFocusTarget(), static_cast<UObject*>(FarTarget));
+					TestEqual("EnterFarFocus", FarTarget->NumEnter, 2);
+
+					OtherPointer->bUseBatchedRayQuery = true;
+					HandTracker->SetAllJointPositions(FVector(0, 10, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this, OtherPointer]()
+				{
+					TestEqual("Hit Point", Pointer->GetHitPoint(), TargetLocation - FVector(50, -10, 0));
+					TestEqual("Other Hit Point", OtherPointer->GetHitPoint(), TargetLocation - FVector(50, -10, 0));
+					HandTracker->SetAllJointPositions(FVector(-500, 0, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this, OtherPointer, Done]()
+				{
+					TestNull("Hit Primitive", Pointer->GetHitPrimitive());
+					TestNull("Other Hit Primitive", OtherPointer->GetHitPrimitive());
+					TestEqual("ExitFarFocus", FarTarget->NumExit, 2);
+					Done.Execute();
+				});
+		});
+
+	LatentIt(
+		"should select targets near the ray when cone casting",
+		[this](const FDoneDelegate& Done)
+		{
+			// The ray passes 10 units beside the target, about 3 degrees away from its closest point
+			HandTracker->SetAllJointPositions(FVector(0, 60, 0));
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					TestNull("Hit Primitive", Pointer->GetHitPrimitive());
+					Pointer->bUseConeCast = true;
+				});
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					TestEqual("Hit Point", Pointer->GetHitPoint(), TargetLocation + FVector(0, 50, 0));
+					TestEqual("Hit Normal", Pointer->GetHitNormal(), FVector(0, 1, 0));
+
+					// Beyond the cone angle but within the hysteresis of the focused target
+					HandTracker->SetAllJointPositions(FVector(0, 70, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					HandTracker->SetAllJointPositions(FVector(0, 80, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					TestNull("Hit Primitive", Pointer->GetHitPrimitive());
+
+					// Without focus the target must be within the cone angle
+					HandTracker->SetAllJointPositions(FVector(0, 70, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this, Done]()
+				{
+					TestNull("Hit Primitive", Pointer->GetHitPrimitive());
+					Done.Execute();
+				});
+		});
+
+	LatentIt(
+		"should keep focus within the focus switch margin",
+		[this](const FDoneDelegate& Done)
+		{
+			// Second target adjacent to the first one
+			AActor* OtherTargetActor = UxtTestUtils::GetTestWorld()->SpawnActor<AActor>();
+			UFarTargetTestComponent* OtherFarTarget = NewObject<UFarTargetTestComponent>(OtherTargetActor);
+			OtherFarTarget->RegisterComponent();
+			UStaticMeshComponent* OtherMesh = UxtTestUtils::CreateStaticMesh(OtherTargetActor);
+			OtherTargetActor->SetRootComponent(OtherMesh);
+			OtherMesh->RegisterComponent();
+			OtherTargetActor->SetActorLocation(TargetLocation + FVector(0, 100, 0));
+
+			Pointer->FocusSwitchMargin = 20.0f;
+			HandTracker->SetAllJointPositions(FVector(0, 45, 0));
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					HandTracker->SetAllJointPositions(FVector(0, 55, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					// The ray is within the margin of the focused target
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					TestEqual("Hit Point", Pointer->GetHitPoint(), TargetLocation + FVector(-50, 50, 0));
+					HandTracker->SetAllJointPositions(FVector(0, 80, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this, OtherMesh, OtherFarTarget, Done]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), static_cast<UPrimitiveComponent*>(OtherMesh));
+					TestEqual("ExitFarFocus", FarTarget->NumExit, 1);
+					TestEqual("Other EnterFarFocus", OtherFarTarget->NumEnter, 1);
+					Done.Execute();
+				});
+		});
+
+	LatentIt(
+		"should switch focus after the focus switch dwell time",
+		[this](const FDoneDelegate& Done)
+		{
+			AActor* OtherTargetActor = UxtTestUtils::GetTestWorld()->SpawnActor<AActor>();
+			UFarTargetTestComponent* OtherFarTarget = NewObject<UFarTargetTestComponent>(OtherTargetActor);
+			OtherFarTarget->RegisterComponent();
+			UStaticMeshComponent* OtherMesh = UxtTestUtils::CreateStaticMesh(OtherTargetActor);
+			OtherTargetActor->SetRootComponent(OtherMesh);
+			OtherMesh->RegisterComponent();
+			OtherTargetActor->SetActorLocation(TargetLocation + FVector(0, 100, 0));
+
+			const float DwellTime = 0.25f;
+			Pointer->FocusSwitchDwellTime = DwellTime;
+			HandTracker->SetAllJointPositions(FVector(0, 45, 0));
+
+			FrameQueue.Enqueue(
+				[this]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					HandTracker->SetAllJointPositions(FVector(0, 80, 0));
+				});
+
+			FrameQueue.Enqueue(
+				[this, OtherFarTarget, DwellTime]()
+				{
+					// The ray hits the other target, but has not for the dwell time yet
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), HitPrimitive);
+					TestEqual("Other EnterFarFocus", OtherFarTarget->NumEnter, 0);
+
+					// Pause the queue until the dwell time has passed in the world, the pointer keeps ticking meanwhile
+					FrameQueue.Pause();
+					FTimerHandle DummyHandle;
+					UxtTestUtils::GetTestWorld()->GetTimerManager().SetTimer(
+						DummyHandle, FTimerDelegate::CreateLambda([this] { FrameQueue.Resume(); }), DwellTime * 2.0f, false);
+				});
+
+			FrameQueue.Enqueue(
+				[this, OtherMesh, OtherFarTarget, Done]()
+				{
+					TestEqual("Hit Primitive", Pointer->GetHitPrimitive(), static_cast<UPrimitiveComponent*>(OtherMesh));
+					TestEqual("ExitFarFocus", FarTarget->NumExit, 1);
+					TestEqual("Other EnterFarFocus", OtherFarTarget->NumEnter, 1);
+					Done.Execute();
+				});
+		});
+
 	LatentIt(
 		"should lock to current target when requested",
 		[this](const FDoneDelegate& Done)
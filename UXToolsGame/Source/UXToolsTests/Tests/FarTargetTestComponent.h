@@ -7,6 +7,7 @@
 
 #include "Components/ActorComponent.h"
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Interactions/UxtFarHandler.h"
 #include "Interactions/UxtFarTarget.h"
 
@@ -52,3 +53,52 @@ public:
 	int NumDragged = 0;
 	int NumReleased = 0;
 };
+
+/**
+ * Far event counter that adds and destroys handler components of its actor when it gains focus.
+ * Can also raise a nested focus update event from its focus event.
+ */
+UCLASS(ClassGroup = "UXToolsTests")
+class UXTOOLSTESTS_API UFarTargetReentrantTestComponent : public UFarTargetTestComponent
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnEnterFarFocus_Implementation(UUxtFarPointerComponent* Pointer) override
+	{
+		Super::OnEnterFarFocus_Implementation(Pointer);
+
+		if (bAddHandler)
+		{
+			bAddHandler = false;
+			AddedHandler = NewObject<UFarTargetTestComponent>(GetOwner());
+			AddedHandler->RegisterComponent();
+		}
+
+		if (HandlerToDestroy)
+		{
+			HandlerToDestroy->DestroyComponent();
+			HandlerToDestroy = nullptr;
+		}
+
+		if (NestedEventTarget)
+		{
+			UUxtInputSubsystem::RaiseUpdatedFarFocus(NestedEventTarget, Pointer);
+		}
+	}
+
+	/** Add a handler component on the next focus event. */
+	bool bAddHandler = false;
+
+	/** Handler component added during the last focus event. */
+	UPROPERTY(Transient)
+	UFarTargetTestComponent* AddedHandler = nullptr;
+
+	/** Handler component to destroy on the next focus event. */
+	UPROPERTY(Transient)
+	UActorComponent* HandlerToDestroy = nullptr;
+
+	/** Primitive to raise a focus update event on from every focus event. */
+	UPROPERTY(Transient)
+	UPrimitiveComponent* NestedEventTarget = nullptr;
+};
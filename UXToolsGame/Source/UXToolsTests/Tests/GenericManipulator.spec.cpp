@@ -475,6 +475,58 @@ void GenericManipulatorSpec::EnqueueInteractionTests()
 
 			FrameQueue.Enqueue([Done] { Done.Execute(); });
 		});
+
+	LatentIt(
+		"should keep the hand angular velocity on release",
+		[this](const FDoneDelegate& Done)
+		{
+			UStaticMeshComponent* StaticMesh = Target->GetOwner()->FindComponentByClass<UStaticMeshComponent>();
+			const float RotationRate = 90.0f;
+
+			// Rotate in proportion to the frame time so that the hand turns at a known rate whatever the frame rate
+			auto RotateHand = [this, RotationRate]
+			{
+				const float Angle = FMath::DegreesToRadians(RotationRate * FApp::GetDeltaTime());
+				RightHand.Rotate(FQuat(FVector::ForwardVector, Angle));
+			};
+
+			FrameQueue.Enqueue(
+				[this, StaticMesh]
+				{
+					Target->ReleaseBehavior = static_cast<int32>(EUxtReleaseBehavior::KeepAngularVelocity);
+					StaticMesh->SetEnableGravity(false);
+					StaticMesh->SetSimulatePhysics(true);
+					RightHand.SetGrabbing(true);
+				});
+
+			for (int32 Frame = 0; Frame < 10; ++Frame)
+			{
+				FrameQueue.Enqueue(RotateHand);
+			}
+
+			// Keep rotating while the release is processed
+			FrameQueue.Enqueue(
+				[this, RotateHand]
+				{
+					TestTrue("Object is grabbed", Target->GetGrabPointers().Num() > 0);
+					RotateHand();
+					RightHand.SetGrabbing(false);
+				});
+			FrameQueue.Enqueue(RotateHand);
+
+			FrameQueue.Enqueue(
+				[this, StaticMesh, RotationRate]
+				{
+					TestEqual("Object is not grabbed", Target->GetGrabPointers().Num(), 0);
+					TestTrue("Physics is enabled", StaticMesh->IsSimulatingPhysics());
+
+					// Angular velocity of the hand is in degrees per second around the world space rotation axis
+					const FVector AngularVelocity = StaticMesh->GetPhysicsAngularVelocityInDegrees();
+					TestEqual("Angular velocity", AngularVelocity, FVector(RotationRate, 0, 0), RotationRate * 0.1f);
+				});
+
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,125 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestHandTracker.h"
+
+#include "HandTracking/UxtHandFrame.h"
+#include "HandTracking/UxtHandFrameCache.h"
+#include "HandTracking/UxtHandHistory.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(HandFrameSpec, "UXTools.HandFrame", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+TUniquePtr<FUxtTestHandTracker> HandTracker;
+
+END_DEFINE_SPEC(HandFrameSpec)
+
+void HandFrameSpec::Define()
+{
+	BeforeEach([this] { HandTracker = MakeUnique<FUxtTestHandTracker>(); });
+
+	AfterEach([this] { HandTracker.Reset(); });
+
+	It("should derive values from the joints",
+	   [this]
+	   {
+		   HandTracker->SetJointPosition(FVector(10, 0, 0), EControllerHand::Left, EHandKeypoint::IndexTip);
+		   HandTracker->SetJointPosition(FVector(0, 10, 0), EControllerHand::Left, EHandKeypoint::ThumbTip);
+
+		   const FUxtHandFrame& HandFrame = HandTracker->GetHandFrame(EControllerHand::Left);
+		   TestTrue("Has joints", HandFrame.HasJoints());
+		   TestEqual("Index tip", HandFrame.GetJointPosition(EHandKeypoint::IndexTip), FVector(10, 0, 0));
+		   TestEqual("Grab pointer location", HandFrame.GetGrabPointerTransform().GetLocation(), FVector(5, 5, 0));
+		   TestEqual("Pinch distance", HandFrame.GetPinchDistance(), FMath::Sqrt(200.0f));
+	   });
+
+	It("should recapture the frame when the hand changes",
+	   [this]
+	   {
+		   const FUxtHandFrame& HandFrame = HandTracker->GetHandFrame(EControllerHand::Left);
+		   TestEqual("Initial grab pointer location", HandFrame.GetGrabPointerTransform().GetLocation(), FVector::ZeroVector);
+
+		   HandTracker->SetAllJointPositions(FVector(0, 0, 20), EControllerHand::Left);
+
+		   const FUxtHandFrame& NewHandFrame = HandTracker->GetHandFrame(EControllerHand::Left);
+		   TestEqual("New grab pointer location", NewHandFrame.GetGrabPointerTransform().GetLocation(), FVector(0, 0, 20));
+	   });
+
+	It("should capture other hands separately",
+	   [this]
+	   {
+		   TestTrue("Any hand", HandTracker->GetHandFrame(EControllerHand::AnyHand).GetHand() == EControllerHand::AnyHand);
+		   TestTrue("Pad", HandTracker->GetHandFrame(EControllerHand::Pad).GetHand() == EControllerHand::Pad);
+		   TestTrue("Any hand again", HandTracker->GetHandFrame(EControllerHand::AnyHand).GetHand() == EControllerHand::AnyHand);
+
+		   // Only the left and right hands keep a history
+		   TestEqual("Any hand history", HandTracker->GetHandHistory(EControllerHand::AnyHand).Num(), 0);
+		   TestEqual("Left hand history", HandTracker->GetHandHistory(EControllerHand::Left).Num(), 1);
+	   });
+
+	It("should not keep histories if disabled",
+	   [this]
+	   {
+		   FUxtHandFrameCache HandFrameCache(false);
+		   TestTrue("Has joints", HandFrameCache.GetHandFrame(*HandTracker, EControllerHand::Left).HasJoints());
+		   TestEqual("Left hand history", HandFrameCache.GetHandHistory(*HandTracker, EControllerHand::Left).Num(), 0);
+	   });
+
+	It("should use defaults if the hand is not tracked",
+	   [this]
+	   {
+		   HandTracker->SetTracked(false, EControllerHand::Left);
+
+		   const FUxtHandFrame& HandFrame = HandTracker->GetHandFrame(EControllerHand::Left);
+		   TestFalse("Has joints", HandFrame.HasJoints());
+		   TestFalse("Has grip pose", HandFrame.HasGripPose());
+		   TestTrue("Grab pointer is identity", HandFrame.GetGrabPointerTransform().Equals(FTransform::Identity));
+		   TestFalse("Bounds are valid", (bool)HandFrame.GetBounds().IsValid);
+		   TestTrue("Is in pointing pose", HandFrame.IsInPointingPose(FVector::ForwardVector));
+
+		   TestTrue("Other hand has joints", HandTracker->GetHandFrame(EControllerHand::Right).HasJoints());
+	   });
+
+	It("should compute the bounds in palm space",
+	   [this]
+	   {
+		   HandTracker->SetAllJointPositions(FVector(100, 0, 0), EControllerHand::Left);
+		   HandTracker->SetAllJointRadii(2.0f, EControllerHand::Left);
+		   HandTracker->SetJointPosition(FVector(110, 0, 0), EControllerHand::Left, EHandKeypoint::IndexTip);
+
+		   const FBox& Bounds = HandTracker->GetHandFrame(EControllerHand::Left).GetBounds();
+		   TestEqual("Bounds min", Bounds.Min, FVector(-2, -2, -2));
+		   TestEqual("Bounds max", Bounds.Max, FVector(12, 2, 2));
+	   });
+
+	It("should mirror the finger plane for the right hand",
+	   [this]
+	   {
+		   HandTracker->SetJointPosition(FVector(10, -2, 0), EControllerHand::AnyHand, EHandKeypoint::IndexTip);
+		   HandTracker->SetJointPosition(FVector(10, 2, 0), EControllerHand::AnyHand, EHandKeypoint::RingTip);
+
+		   const FVector LeftNormal = HandTracker->GetHandFrame(EControllerHand::Left).GetFingerPlaneNormal();
+		   const FVector RightNormal = HandTracker->GetHandFrame(EControllerHand::Right).GetFingerPlaneNormal();
+		   TestTrue("Left normal is vertical", FMath::IsNearlyEqual(FMath::Abs(LeftNormal.Z), 1.0f));
+		   TestEqual("Right normal", RightNormal, -LeftNormal);
+	   });
+
+	It("should report the pointing pose from the palm orientation",
+	   [this]
+	   {
+		   // Palm up vector is the back of the hand, the inside of the palm faces down
+		   HandTracker->SetJointOrientation(FQuat::Identity, EControllerHand::Left, EHandKeypoint::Palm);
+		   TestTrue("Palm down is pointing", HandTracker->GetHandFrame(EControllerHand::Left).IsInPointingPose(FVector::ForwardVector));
+
+		   // Inside of the palm facing the viewer
+		   const FQuat PalmToViewer = FQuat(FVector::RightVector, FMath::DegreesToRadians(90.0f));
+		   HandTracker->SetJointOrientation(PalmToViewer, EControllerHand::Left, EHandKeypoint::Palm);
+		   const FUxtHandFrame& HandFrame = HandTracker->GetHandFrame(EControllerHand::Left);
+		   TestFalse("Palm facing viewer is not pointing", HandFrame.IsInPointingPose(FVector::ForwardVector));
+	   });
+}
+
+#endif
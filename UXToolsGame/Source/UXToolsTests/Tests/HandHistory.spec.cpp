@@ -0,0 +1,142 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestHandTracker.h"
+
+#include "HandTracking/UxtHandHistory.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	HandHistorySpec, "UXTools.HandHistory", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+TUniquePtr<FUxtTestHandTracker> HandTracker;
+FUxtHandHistory History;
+
+const double SampleInterval = 0.01;
+
+void AddSample(double Time, const FQuat& Orientation, const FVector& Position);
+
+END_DEFINE_SPEC(HandHistorySpec)
+
+void HandHistorySpec::AddSample(double Time, const FQuat& Orientation, const FVector& Position)
+{
+	HandTracker->SetAllJointOrientations(Orientation, EControllerHand::Left);
+	HandTracker->SetAllJointPositions(Position, EControllerHand::Left);
+
+	FUxtHandFrame HandFrame;
+	HandFrame.Capture(*HandTracker, EControllerHand::Left);
+	History.AddSample(Time, HandFrame);
+}
+
+void HandHistorySpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			HandTracker = MakeUnique<FUxtTestHandTracker>();
+			History.Reset();
+		});
+
+	AfterEach([this] { HandTracker.Reset(); });
+
+	It("should look up samples by age",
+	   [this]
+	   {
+		   for (int32 Index = 0; Index < 3; ++Index)
+		   {
+			   AddSample(Index * SampleInterval, FQuat::Identity, FVector(Index, 0, 0));
+		   }
+
+		   TestEqual("Samples", History.Num(), 3);
+		   TestEqual("Latest time", History.GetSample(0).Time, 2 * SampleInterval);
+		   TestEqual("Latest position", History.GetSample(0).GetPose(EUxtHandHistoryPose::Joint).GetLocation(), FVector(2, 0, 0));
+		   TestEqual("Oldest position", History.GetSample(2).GetPose(EUxtHandHistoryPose::Joint).GetLocation(), FVector(0, 0, 0));
+	   });
+
+	It("should keep a fixed number of samples",
+	   [this]
+	   {
+		   const int32 NumAdded = FUxtHandHistory::Capacity + 5;
+		   for (int32 Index = 0; Index < NumAdded; ++Index)
+		   {
+			   AddSample(Index * SampleInterval, FQuat::Identity, FVector(Index, 0, 0));
+		   }
+
+		   TestEqual("Samples", History.Num(), FUxtHandHistory::Capacity);
+		   TestEqual(
+			   "Oldest position", History.GetSample(FUxtHandHistory::Capacity - 1).GetPose(EUxtHandHistoryPose::Joint).GetLocation(),
+			   FVector(NumAdded - FUxtHandHistory::Capacity, 0, 0));
+	   });
+
+	It("should interpolate poses between samples",
+	   [this]
+	   {
+		   AddSample(0.0, FQuat::Identity, FVector::ZeroVector);
+		   AddSample(SampleInterval, FQuat(FVector::UpVector, 0.2f), FVector(2, 0, 0));
+
+		   FTransform Pose;
+		   TestTrue(
+			   "Pose available", History.GetPoseAtTime(EUxtHandHistoryPose::Joint, 0.5 * SampleInterval, Pose, EHandKeypoint::IndexTip));
+		   TestEqual("Position", Pose.GetLocation(), FVector(1, 0, 0), 0.001f);
+		   TestTrue("Orientation", Pose.GetRotation().Equals(FQuat(FVector::UpVector, 0.1f), 0.001f));
+
+		   TestFalse("Time before the history", History.GetPoseAtTime(EUxtHandHistoryPose::Grip, -SampleInterval, Pose));
+		   TestFalse("Time after the history", History.GetPoseAtTime(EUxtHandHistoryPose::Grip, 2 * SampleInterval, Pose));
+	   });
+
+	It("should estimate velocities over the window",
+	   [this]
+	   {
+		   const float AngleStep = 0.1f;
+		   for (int32 Index = 0; Index < 5; ++Index)
+		   {
+			   // Accelerate along X so that the window matters
+			   AddSample(Index * SampleInterval, FQuat(FVector::UpVector, Index * AngleStep), FVector(Index * Index, 0, 0));
+		   }
+
+		   FVector Velocity;
+		   TestTrue("Velocity available", History.GetLinearVelocity(EUxtHandHistoryPose::Pointer, SampleInterval, Velocity));
+		   TestEqual("Velocity over the last interval", Velocity, FVector(7 / SampleInterval, 0, 0), 0.01f);
+
+		   History.GetLinearVelocity(EUxtHandHistoryPose::Pointer, 2 * SampleInterval, Velocity);
+		   TestEqual("Velocity over two intervals", Velocity, FVector(6 / SampleInterval, 0, 0), 0.01f);
+
+		   History.GetLinearVelocity(EUxtHandHistoryPose::Pointer, 1.0f, Velocity);
+		   TestEqual("Window clamped to the history", Velocity, FVector(4 / SampleInterval, 0, 0), 0.01f);
+
+		   FVector AngularVelocity;
+		   TestTrue("Angular velocity available", History.GetAngularVelocity(EUxtHandHistoryPose::Grip, 1.0f, AngularVelocity));
+		   TestEqual("Angular velocity", AngularVelocity, FVector(0, 0, AngleStep / SampleInterval), 0.01f);
+	   });
+
+	It("should restart when tracking is lost",
+	   [this]
+	   {
+		   AddSample(0.0, FQuat::Identity, FVector::ZeroVector);
+		   AddSample(SampleInterval, FQuat::Identity, FVector(1, 0, 0));
+
+		   HandTracker->SetTracked(false, EControllerHand::Left);
+		   AddSample(2 * SampleInterval, FQuat::Identity, FVector::ZeroVector);
+
+		   TestEqual("Samples", History.Num(), 1);
+		   TestFalse("Joints available", History.HasPose(EUxtHandHistoryPose::Joint));
+
+		   FVector Velocity;
+		   TestFalse("Velocity available", History.GetLinearVelocity(EUxtHandHistoryPose::Joint, 1.0f, Velocity));
+	   });
+
+	It("should be sampled by the hand tracker",
+	   [this]
+	   {
+		   HandTracker->SetAllJointPositions(FVector(1, 2, 3), EControllerHand::Left);
+
+		   const FUxtHandHistory& TrackerHistory = HandTracker->GetHandHistory(EControllerHand::Left);
+		   TestEqual("Samples", TrackerHistory.Num(), 1);
+		   TestEqual("Position", TrackerHistory.GetSample(0).GetPose(EUxtHandHistoryPose::Joint).GetLocation(), FVector(1, 2, 3));
+	   });
+}
+
+#endif
@@ -0,0 +1,127 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+
+#include "HandTracking/UxtHandJointFilter.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	HandJointFilterSpec, "UXTools.HandJointFilter", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+FUxtHandJointFilter Filter;
+FUxtHandJointFilterSettings Settings;
+FQuat Orientations[EHandKeypointCount];
+FVector Positions[EHandKeypointCount];
+
+const float DeltaTime = 1.0f / 60.0f;
+
+void SetJoints(const FQuat& Orientation, const FVector& Position);
+
+END_DEFINE_SPEC(HandJointFilterSpec)
+
+void HandJointFilterSpec::SetJoints(const FQuat& Orientation, const FVector& Position)
+{
+	for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+	{
+		Orientations[Joint] = Orientation;
+		Positions[Joint] = Position;
+	}
+}
+
+void HandJointFilterSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			Filter.Reset();
+			Settings = FUxtHandJointFilterSettings();
+			Settings.bEnabled = true;
+			SetJoints(FQuat::Identity, FVector::ZeroVector);
+		});
+
+	It("should pass the first joints through",
+	   [this]
+	   {
+		   SetJoints(FQuat(FVector::UpVector, 1.0f), FVector(10, 20, 30));
+		   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+
+		   TestTrue("Has state", Filter.HasState());
+		   TestEqual("Position", Filter.GetPositions()[(int32)EHandKeypoint::IndexTip], FVector(10, 20, 30));
+		   TestTrue("Orientation", Filter.GetOrientations()[(int32)EHandKeypoint::Palm].Equals(FQuat(FVector::UpVector, 1.0f)));
+	   });
+
+	It("should smooth a step and converge",
+	   [this]
+	   {
+		   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+
+		   SetJoints(FQuat(FVector::UpVector, 1.0f), FVector(10, 0, 0));
+		   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+
+		   const double FirstX = Filter.GetPositions()[(int32)EHandKeypoint::Palm].X;
+		   TestTrue("Position lags behind the step", FirstX > 0.0f && FirstX < 10.0f);
+		   const double FirstAngle = Filter.GetOrientations()[(int32)EHandKeypoint::Palm].GetAngle();
+		   TestTrue("Orientation lags behind the step", FirstAngle > 0.0f && FirstAngle < 1.0f);
+
+		   for (int32 Frame = 0; Frame < 600; ++Frame)
+		   {
+			   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+		   }
+
+		   TestEqual("Position converges", Filter.GetPositions()[(int32)EHandKeypoint::Palm], FVector(10, 0, 0), 0.01f);
+		   TestTrue("Orientation converges", Filter.GetOrientations()[(int32)EHandKeypoint::Palm].Equals(Orientations[0], 0.001f));
+	   });
+
+	It("should follow finger tips more closely than the palm",
+	   [this]
+	   {
+		   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+
+		   SetJoints(FQuat::Identity, FVector(10, 0, 0));
+		   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+
+		   const double PalmX = Filter.GetPositions()[(int32)EHandKeypoint::Palm].X;
+		   const double TipX = Filter.GetPositions()[(int32)EHandKeypoint::IndexTip].X;
+		   TestTrue("Tip is closer to the new position", TipX > PalmX);
+	   });
+
+	It("should follow fast movement more closely than slow movement",
+	   [this]
+	   {
+		   FUxtHandJointFilter SlowFilter;
+		   SlowFilter.Update(Orientations, Positions, DeltaTime, Settings);
+		   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+
+		   const int32 NumFrames = 10;
+		   for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+		   {
+			   SetJoints(FQuat::Identity, FVector(Frame * 0.1f, 0, 0));
+			   SlowFilter.Update(Orientations, Positions, DeltaTime, Settings);
+
+			   SetJoints(FQuat::Identity, FVector(Frame * 10.0f, 0, 0));
+			   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+		   }
+
+		   // Compare the lag relative to the distance travelled
+		   const double SlowLag = (NumFrames * 0.1f - SlowFilter.GetPositions()[0].X) / (NumFrames * 0.1f);
+		   const double FastLag = (NumFrames * 10.0f - Filter.GetPositions()[0].X) / (NumFrames * 10.0f);
+		   TestTrue("Fast movement lags less", FastLag < SlowLag);
+	   });
+
+	It("should pass joints through after a reset",
+	   [this]
+	   {
+		   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+		   Filter.Reset();
+		   TestFalse("Has state", Filter.HasState());
+
+		   SetJoints(FQuat::Identity, FVector(50, 0, 0));
+		   Filter.Update(Orientations, Positions, DeltaTime, Settings);
+		   TestEqual("Position", Filter.GetPositions()[0], FVector(50, 0, 0));
+	   });
+}
+
+#endif
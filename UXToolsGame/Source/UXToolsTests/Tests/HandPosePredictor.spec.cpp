@@ -0,0 +1,147 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestHandTracker.h"
+
+#include "HandTracking/UxtHandPosePredictor.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	HandPosePredictorSpec, "UXTools.HandPosePredictor", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+TUniquePtr<FUxtTestHandTracker> HandTracker;
+FUxtHandHistory History;
+FUxtHandPosePredictor Predictor = FUxtHandPosePredictor(History);
+
+const double SampleInterval = 0.01;
+const float MaxPredictionTime = 0.05f;
+
+void AddSample(double Time, const FQuat& Orientation, const FVector& Position);
+
+END_DEFINE_SPEC(HandPosePredictorSpec)
+
+void HandPosePredictorSpec::AddSample(double Time, const FQuat& Orientation, const FVector& Position)
+{
+	HandTracker->SetAllJointOrientations(Orientation, EControllerHand::Left);
+	HandTracker->SetAllJointPositions(Position, EControllerHand::Left);
+
+	FUxtHandFrame HandFrame;
+	HandFrame.Capture(*HandTracker, EControllerHand::Left);
+	History.AddSample(Time, HandFrame);
+}
+
+void HandPosePredictorSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			HandTracker = MakeUnique<FUxtTestHandTracker>();
+			History.Reset();
+		});
+
+	AfterEach([this] { HandTracker.Reset(); });
+
+	It("should extrapolate positions with the estimated velocity",
+	   [this]
+	   {
+		   for (int32 Index = 0; Index < 3; ++Index)
+		   {
+			   AddSample(Index * SampleInterval, FQuat::Identity, FVector(Index, 0, 0));
+		   }
+
+		   FQuat Orientation;
+		   FVector Position;
+		   const double TargetTime = 3 * SampleInterval;
+		   TestTrue(
+			   "Joint predicted", Predictor.PredictJoint(EHandKeypoint::IndexTip, TargetTime, MaxPredictionTime, Orientation, Position));
+		   TestEqual("Joint position", Position, FVector(3, 0, 0), 0.001f);
+
+		   TestTrue("Grip predicted", Predictor.PredictGripPose(TargetTime, MaxPredictionTime, Orientation, Position));
+		   TestEqual("Grip position", Position, FVector(3, 0, 0), 0.001f);
+	   });
+
+	It("should limit the prediction horizon",
+	   [this]
+	   {
+		   AddSample(0.0, FQuat::Identity, FVector::ZeroVector);
+		   AddSample(SampleInterval, FQuat::Identity, FVector(1, 0, 0));
+
+		   FQuat Orientation;
+		   FVector Position;
+		   Predictor.PredictJoint(EHandKeypoint::Palm, 1.0, MaxPredictionTime, Orientation, Position);
+		   TestEqual("Position", Position, FVector(1 + MaxPredictionTime / SampleInterval, 0, 0), 0.001f);
+
+		   Predictor.PredictJoint(EHandKeypoint::Palm, 0.0, MaxPredictionTime, Orientation, Position);
+		   TestEqual("Past targets return the latest position", Position, FVector(1, 0, 0));
+	   });
+
+	It("should extrapolate orientations with the estimated angular velocity",
+	   [this]
+	   {
+		   const float AngleStep = 0.1f;
+		   for (int32 Index = 0; Index < 3; ++Index)
+		   {
+			   AddSample(Index * SampleInterval, FQuat(FVector::UpVector, Index * AngleStep), FVector::ZeroVector);
+		   }
+
+		   FQuat Orientation;
+		   FVector Position;
+		   Predictor.PredictPointerPose(3 * SampleInterval, MaxPredictionTime, Orientation, Position);
+		   TestTrue("Orientation", Orientation.Equals(FQuat(FVector::UpVector, 3 * AngleStep), 0.001f));
+	   });
+
+	It("should restart the history when tracking is lost",
+	   [this]
+	   {
+		   AddSample(0.0, FQuat::Identity, FVector::ZeroVector);
+		   AddSample(SampleInterval, FQuat::Identity, FVector(1, 0, 0));
+
+		   HandTracker->SetTracked(false, EControllerHand::Left);
+		   AddSample(2 * SampleInterval, FQuat::Identity, FVector(2, 0, 0));
+
+		   FQuat Orientation;
+		   FVector Position;
+		   TestFalse("Joint predicted", Predictor.PredictJoint(EHandKeypoint::Palm, 1.0, MaxPredictionTime, Orientation, Position));
+
+		   HandTracker->SetTracked(true, EControllerHand::Left);
+		   AddSample(3 * SampleInterval, FQuat::Identity, FVector(10, 0, 0));
+
+		   TestEqual("Samples", History.Num(), 1);
+		   Predictor.PredictJoint(EHandKeypoint::Palm, 4 * SampleInterval, MaxPredictionTime, Orientation, Position);
+		   TestEqual("Position is not extrapolated", Position, FVector(10, 0, 0));
+	   });
+
+	It("should replace samples at the same time",
+	   [this]
+	   {
+		   AddSample(0.0, FQuat::Identity, FVector::ZeroVector);
+		   AddSample(SampleInterval, FQuat::Identity, FVector(5, 0, 0));
+		   AddSample(SampleInterval, FQuat::Identity, FVector(1, 0, 0));
+
+		   TestEqual("Samples", History.Num(), 2);
+
+		   FQuat Orientation;
+		   FVector Position;
+		   Predictor.PredictJoint(EHandKeypoint::Palm, 2 * SampleInterval, MaxPredictionTime, Orientation, Position);
+		   TestEqual("Position", Position, FVector(2, 0, 0), 0.001f);
+	   });
+
+	It("should return the current pose from the tracker if prediction is disabled",
+	   [this]
+	   {
+		   HandTracker->SetAllJointPositions(FVector(1, 2, 3), EControllerHand::Left);
+
+		   FQuat Orientation;
+		   FVector Position;
+		   float Radius;
+		   TestTrue(
+			   "Joint available",
+			   HandTracker->GetPredictedJointState(EControllerHand::Left, EHandKeypoint::IndexTip, 1.0, Orientation, Position, Radius));
+		   TestEqual("Position", Position, FVector(1, 2, 3));
+	   });
+}
+
+#endif
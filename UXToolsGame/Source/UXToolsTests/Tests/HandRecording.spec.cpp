@@ -0,0 +1,282 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "UxtHandReplay.h"
+#include "UxtTestHandTracker.h"
+#include "UxtTestUtils.h"
+
+#include "GameFramework/Actor.h"
+#include "HandTracking/IUxtHandTracker.h"
+#include "HandTracking/UxtHandRecorderComponent.h"
+#include "HandTracking/UxtHandRecording.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	bool HandStatesEqual(const FUxtRecordedHandState& A, const FUxtRecordedHandState& B)
+	{
+		if (A.bIsTracked != B.bIsTracked || A.bIsHandController != B.bIsHandController || A.bIsGrabbing != B.bIsGrabbing ||
+			A.bIsSelectPressed != B.bIsSelectPressed || A.bHasJoints != B.bHasJoints || A.bHasPointerPose != B.bHasPointerPose ||
+			A.bHasGripPose != B.bHasGripPose)
+		{
+			return false;
+		}
+
+		if (A.bHasJoints)
+		{
+			for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+			{
+				if (!A.JointOrientations[Joint].Equals(B.JointOrientations[Joint]) ||
+					!A.JointPositions[Joint].Equals(B.JointPositions[Joint]) || A.JointRadii[Joint] != B.JointRadii[Joint])
+				{
+					return false;
+				}
+			}
+		}
+
+		if (A.bHasPointerPose && !(A.PointerOrientation.Equals(B.PointerOrientation) && A.PointerPosition.Equals(B.PointerPosition)))
+		{
+			return false;
+		}
+
+		return !A.bHasGripPose || (A.GripOrientation.Equals(B.GripOrientation) && A.GripPosition.Equals(B.GripPosition));
+	}
+
+	bool FramesEqual(const FUxtRecordedFrame& A, const FUxtRecordedFrame& B)
+	{
+		return HandStatesEqual(A.LeftHand, B.LeftHand) && HandStatesEqual(A.RightHand, B.RightHand);
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	HandRecordingSpec, "UXTools.HandRecording",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+FFrameQueue FrameQueue;
+FUxtHandReplay Replay;
+FString RecordingFilename;
+
+END_DEFINE_SPEC(HandRecordingSpec)
+
+void HandRecordingSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			RecordingFilename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("HandRecording.uxthr"));
+
+			Replay.SetRecording(FUxtHandReplay::CreateSweepRecording(FVector(50, 0, 0), FVector(150, 0, 0), 30));
+
+			// Untrack the left hand for a few frames to cover tracking loss
+			FUxtHandRecording Recording = Replay.GetRecording();
+			for (int32 FrameIndex = 10; FrameIndex < 15; ++FrameIndex)
+			{
+				Recording.Frames[FrameIndex].LeftHand = FUxtRecordedHandState();
+			}
+
+			// Switch the right hand to a motion controller for a few frames, which has poses but no joints
+			for (int32 FrameIndex = 20; FrameIndex < 25; ++FrameIndex)
+			{
+				Recording.Frames[FrameIndex].RightHand.bIsHandController = false;
+				Recording.Frames[FrameIndex].RightHand.bHasJoints = false;
+			}
+			Replay.SetRecording(Recording);
+		});
+
+	AfterEach([this] { IFileManager::Get().Delete(*RecordingFilename); });
+
+	It("should restore saved recordings",
+	   [this]
+	   {
+		   FUxtHandRecording Saved = Replay.GetRecording();
+		   TestTrue("Recording saved", Saved.SaveToFile(RecordingFilename));
+
+		   FUxtHandRecording Loaded;
+		   TestTrue("Recording loaded", Loaded.LoadFromFile(RecordingFilename));
+		   TestEqual("Number of frames", Loaded.Frames.Num(), Saved.Frames.Num());
+
+		   for (int32 FrameIndex = 0; FrameIndex < FMath::Min(Loaded.Frames.Num(), Saved.Frames.Num()); ++FrameIndex)
+		   {
+			   TestEqual("Frame delta time", Loaded.Frames[FrameIndex].DeltaTime, Saved.Frames[FrameIndex].DeltaTime);
+			   TestTrue("Frame restored", FramesEqual(Loaded.Frames[FrameIndex], Saved.Frames[FrameIndex]));
+		   }
+	   });
+
+	It("should record each channel only if available",
+	   [this]
+	   {
+		   FUxtTestHandTracker HandTracker;
+		   HandTracker.SetPointerPose(FTransform(FVector(1, 2, 3)));
+		   HandTracker.SetJointsAvailable(false, EControllerHand::Left);
+		   HandTracker.SetGripPoseAvailable(false, EControllerHand::Right);
+
+		   FUxtRecordedFrame Frame;
+		   Frame.LeftHand.Capture(HandTracker, EControllerHand::Left);
+		   Frame.RightHand.Capture(HandTracker, EControllerHand::Right);
+
+		   TestTrue("Motion controller tracked", Frame.LeftHand.bIsTracked);
+		   TestFalse("Motion controller is hand controller", Frame.LeftHand.bIsHandController);
+		   TestFalse("Motion controller has joints", Frame.LeftHand.bHasJoints);
+		   TestTrue("Motion controller has pointer pose", Frame.LeftHand.bHasPointerPose);
+		   TestTrue("Motion controller pointer position", Frame.LeftHand.PointerPosition.Equals(FVector3f(1, 2, 3)));
+		   TestTrue("Motion controller has grip pose", Frame.LeftHand.bHasGripPose);
+
+		   TestTrue("Hand tracked", Frame.RightHand.bIsTracked);
+		   TestTrue("Hand has joints", Frame.RightHand.bHasJoints);
+		   TestTrue("Hand has pointer pose", Frame.RightHand.bHasPointerPose);
+		   TestFalse("Hand has grip pose", Frame.RightHand.bHasGripPose);
+
+		   FUxtHandRecording Saved;
+		   Saved.Frames.Add(Frame);
+		   TestTrue("Recording saved", Saved.SaveToFile(RecordingFilename));
+
+		   FUxtHandRecording Loaded;
+		   TestTrue("Recording loaded", Loaded.LoadFromFile(RecordingFilename));
+		   TestTrue("Frame restored", Loaded.Frames.Num() == 1 && FramesEqual(Loaded.Frames[0], Frame));
+	   });
+
+	It("should reject invalid files",
+	   [this]
+	   {
+		   TArray<uint8> Garbage;
+		   Garbage.Init(0xAB, 64);
+		   FFileHelper::SaveArrayToFile(Garbage, *RecordingFilename);
+
+		   FUxtHandRecording Loaded;
+		   TestFalse("Recording loaded", Loaded.LoadFromFile(RecordingFilename));
+		   TestEqual("Number of frames", Loaded.Frames.Num(), 0);
+	   });
+
+	Describe(
+		"Playback",
+		[this]
+		{
+			LatentBeforeEach(
+				[this](const FDoneDelegate& Done)
+				{
+					UWorld* World = UxtTestUtils::LoadMap("/Game/UXToolsGame/Tests/Maps/TestEmpty");
+					TestNotNull("World", World);
+
+					UxtTestUtils::EnableTestInputSystem();
+					FrameQueue.Init(&World->GetTimerManager());
+
+					FrameQueue.Enqueue([Done]() { Done.Execute(); });
+				});
+
+			AfterEach(
+				[this]
+				{
+					FrameQueue.Reset();
+					UxtTestUtils::DisableTestInputSystem();
+					UxtTestUtils::ExitGame();
+				});
+
+			LatentIt(
+				"should apply recorded frames to the hand tracker",
+				[this](const FDoneDelegate& Done)
+				{
+					TSharedRef<int32> NumFramesApplied = MakeShared<int32>(0);
+
+					Replay.Enqueue(
+						FrameQueue,
+						[this, NumFramesApplied](int32 FrameIndex)
+						{
+							TestEqual("Frame index", FrameIndex, *NumFramesApplied);
+							++*NumFramesApplied;
+
+							FUxtRecordedFrame Captured;
+							Captured.LeftHand.Capture(IUxtHandTracker::Get(), EControllerHand::Left);
+							Captured.RightHand.Capture(IUxtHandTracker::Get(), EControllerHand::Right);
+							const FUxtRecordedFrame& Recorded = Replay.GetRecording().Frames[FrameIndex];
+							TestTrue("Hand tracker matches recorded frame", FramesEqual(Captured, Recorded));
+						});
+
+					FrameQueue.Enqueue(
+						[this, NumFramesApplied, Done]
+						{
+							TestEqual("Number of frames applied", *NumFramesApplied, Replay.GetRecording().Frames.Num());
+							Done.Execute();
+						});
+				});
+
+			LatentIt(
+				"should apply recorded frames at the recorded times",
+				[this](const FDoneDelegate& Done)
+				{
+					FUxtHandRecording Recording = Replay.GetRecording();
+					Recording.Frames.SetNum(4);
+					for (FUxtRecordedFrame& Frame : Recording.Frames)
+					{
+						Frame.DeltaTime = 0.2f;
+					}
+					Replay.SetRecording(Recording);
+
+					TSharedRef<TArray<double>> ApplyTimes = MakeShared<TArray<double>>();
+					Replay.Enqueue(
+						FrameQueue,
+						[ApplyTimes](int32 FrameIndex) { ApplyTimes->Add(UxtTestUtils::GetTestWorld()->GetTimeSeconds()); });
+
+					FrameQueue.Enqueue(
+						[this, ApplyTimes, Done]
+						{
+							TestEqual("Number of frames applied", ApplyTimes->Num(), 4);
+							for (int32 FrameIndex = 1; FrameIndex < ApplyTimes->Num(); ++FrameIndex)
+							{
+								const double Elapsed = (*ApplyTimes)[FrameIndex] - (*ApplyTimes)[0];
+								TestTrue(
+									FString::Printf(TEXT("Frame %d applied after its recorded time"), FrameIndex),
+									Elapsed >= FrameIndex * 0.2 - 0.001);
+							}
+							Done.Execute();
+						});
+				});
+
+			LatentIt(
+				"should record the hand tracker state every frame",
+				[this](const FDoneDelegate& Done)
+				{
+					AActor* Actor = UxtTestUtils::GetTestWorld()->SpawnActor<AActor>();
+					UUxtHandRecorderComponent* Recorder = NewObject<UUxtHandRecorderComponent>(Actor);
+					Recorder->RegisterComponent();
+
+					Replay.ApplyFrame(20);
+					Recorder->StartRecording();
+					TestTrue("Is recording", Recorder->IsRecording());
+
+					FrameQueue.Skip(3);
+
+					TSharedRef<int32> NumRecordedFrames = MakeShared<int32>(0);
+					FrameQueue.Enqueue(
+						[this, Recorder, NumRecordedFrames]
+						{
+							Recorder->StopRecording();
+							TestFalse("Is recording", Recorder->IsRecording());
+
+							const FUxtHandRecording& Recording = Recorder->GetRecording();
+							TestTrue("Frames recorded", Recording.Frames.Num() > 0);
+							for (const FUxtRecordedFrame& Frame : Recording.Frames)
+							{
+								TestTrue("Recorded frame matches hand tracker", FramesEqual(Frame, Replay.GetRecording().Frames[20]));
+							}
+
+							*NumRecordedFrames = Recorder->GetNumRecordedFrames();
+						});
+
+					// No more frames are recorded once stopped
+					FrameQueue.Enqueue(
+						[this, Recorder, NumRecordedFrames, Done]
+						{
+							TestEqual("Number of recorded frames", Recorder->GetNumRecordedFrames(), *NumRecordedFrames);
+							Done.Execute();
+						});
+				});
+		});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
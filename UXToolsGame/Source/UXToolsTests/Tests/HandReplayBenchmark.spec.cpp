@@ -0,0 +1,159 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "UxtHandReplay.h"
+#include "UxtTestTargetComponent.h"
+#include "UxtTestUtils.h"
+
+#include "Input/UxtHandInteractionActor.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Get the sample at the given percentile of the sorted samples, using the nearest rank. */
+	double GetPercentile(const TArray<double>& SortedSamples, double Percentile)
+	{
+		const int32 Rank = FMath::CeilToInt(Percentile / 100.0 * SortedSamples.Num());
+		return SortedSamples[FMath::Clamp(Rank - 1, 0, SortedSamples.Num() - 1)];
+	}
+} // namespace
+
+/**
+ * Replays a hand recording against a grid of targets and reports percentiles of the per-frame actor tick cost.
+ * The recording can be passed on the command line with -UxtHandRecording=<file>, a synthetic sweep of both hands
+ * over the targets is used otherwise. Does not require rendering, can be run with -nullrhi.
+ */
+BEGIN_DEFINE_SPEC(
+	HandReplayBenchmarkSpec, "UXTools.Benchmark.HandReplay",
+	EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+UWorld* World;
+FFrameQueue FrameQueue;
+FUxtHandReplay Replay;
+
+/** Actor tick time of each replayed frame in milliseconds. */
+TArray<double> TickTimes;
+double TickStartTime;
+bool bIsMeasuring;
+
+FDelegateHandle PreActorTickHandle;
+FDelegateHandle PostActorTickHandle;
+
+const FString TargetFilename = TEXT("/Engine/BasicShapes/Cube.Cube");
+const float TargetScale = 0.1f;
+const int32 TargetGridSize = 5;
+const float TargetSpacing = 15.0f;
+const FVector TargetGridCenter = FVector(100, 0, 0);
+
+END_DEFINE_SPEC(HandReplayBenchmarkSpec)
+
+void HandReplayBenchmarkSpec::Define()
+{
+	LatentBeforeEach(
+		[this](const FDoneDelegate& Done)
+		{
+			World = UxtTestUtils::LoadMap("/Game/UXToolsGame/Tests/Maps/TestEmpty");
+			TestNotNull("World", World);
+
+			UxtTestUtils::EnableTestInputSystem();
+			FrameQueue.Init(&World->GetTimerManager());
+
+			for (EControllerHand Hand : {EControllerHand::Left, EControllerHand::Right})
+			{
+				AUxtHandInteractionActor* HandActor = World->SpawnActor<AUxtHandInteractionActor>();
+				HandActor->SetHand(Hand);
+			}
+
+			// Alternate grab and poke targets in a vertical grid facing the hands
+			for (int32 Row = 0; Row < TargetGridSize; ++Row)
+			{
+				for (int32 Column = 0; Column < TargetGridSize; ++Column)
+				{
+					const FVector Offset(0, (Column - TargetGridSize / 2) * TargetSpacing, (Row - TargetGridSize / 2) * TargetSpacing);
+					if ((Row + Column) % 2 == 0)
+					{
+						UxtTestUtils::CreateNearPointerGrabTarget(World, TargetGridCenter + Offset, TargetFilename, TargetScale);
+					}
+					else
+					{
+						UxtTestUtils::CreateNearPointerPokeTarget(World, TargetGridCenter + Offset, TargetFilename, TargetScale);
+					}
+				}
+			}
+
+			FString RecordingFilename;
+			if (FParse::Value(FCommandLine::Get(), TEXT("UxtHandRecording="), RecordingFilename))
+			{
+				TestTrue("Recording loaded", Replay.LoadRecording(RecordingFilename));
+			}
+			else
+			{
+				Replay.SetRecording(FUxtHandReplay::CreateSweepRecording(FVector(0, 0, 0), TargetGridCenter, 300));
+			}
+
+			TickTimes.Reset();
+			bIsMeasuring = false;
+
+			PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddLambda(
+				[this](UWorld* InWorld, ELevelTick, float)
+				{
+					if (InWorld == World)
+					{
+						TickStartTime = FPlatformTime::Seconds();
+					}
+				});
+			PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddLambda(
+				[this](UWorld* InWorld, ELevelTick, float)
+				{
+					if (InWorld == World && bIsMeasuring)
+					{
+						TickTimes.Add((FPlatformTime::Seconds() - TickStartTime) * 1000.0);
+					}
+				});
+
+			FrameQueue.Enqueue([Done]() { Done.Execute(); });
+		});
+
+	AfterEach(
+		[this]
+		{
+			FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+			FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+			FrameQueue.Reset();
+			UxtTestUtils::DisableTestInputSystem();
+			UxtTestUtils::ExitGame();
+		});
+
+	LatentIt(
+		"should report the per-frame tick cost",
+		[this](const FDoneDelegate& Done)
+		{
+			// Measure from the first replayed frame until the end of playback
+			Replay.Enqueue(FrameQueue, [this](int32 FrameIndex) { bIsMeasuring = true; });
+			FrameQueue.Enqueue(
+				[this, Done]
+				{
+					bIsMeasuring = false;
+
+					TestTrue("Frames measured", TickTimes.Num() > 0);
+					if (TickTimes.Num() > 0)
+					{
+						TickTimes.Sort();
+						AddInfo(FString::Printf(
+							TEXT("Tick cost over %d frames: p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms"), TickTimes.Num(),
+							GetPercentile(TickTimes, 50.0), GetPercentile(TickTimes, 90.0), GetPercentile(TickTimes, 99.0),
+							TickTimes.Last()));
+					}
+
+					Done.Execute();
+				});
+		});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
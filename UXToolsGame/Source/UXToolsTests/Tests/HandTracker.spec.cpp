@@ -0,0 +1,128 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestHandTracker.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Tracker relying on the default batched joint implementation, reporting joints up to the given count. */
+	class FPerJointHandTracker : public IUxtHandTracker
+	{
+	public:
+		virtual ETrackingStatus GetTrackingStatus(EControllerHand Hand) const override { return ETrackingStatus::Tracked; }
+		virtual bool IsHandController(EControllerHand Hand) const override { return true; }
+		virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override { return false; }
+		virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override { return false; }
+		virtual bool GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const override { return false; }
+		virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override { return false; }
+
+		virtual bool GetJointState(
+			EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const override
+		{
+			if ((int32)Joint >= NumAvailableJoints)
+			{
+				return false;
+			}
+
+			OutOrientation = FQuat(FVector::UpVector, (int32)Joint);
+			OutPosition = FVector((int32)Joint, 0, 0);
+			OutRadius = (int32)Joint;
+			return true;
+		}
+
+		int32 NumAvailableJoints = EHandKeypointCount;
+	};
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	HandTrackerSpec, "UXTools.HandTracker", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+TArray<FQuat> Orientations;
+TArray<FVector> Positions;
+TArray<float> Radii;
+
+END_DEFINE_SPEC(HandTrackerSpec)
+
+void HandTrackerSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			Orientations.Init(FQuat::Identity, EHandKeypointCount);
+			Positions.Init(FVector(-1, -1, -1), EHandKeypointCount);
+			Radii.Init(-1.0f, EHandKeypointCount);
+		});
+
+	Describe(
+		"Default batched joint states",
+		[this]
+		{
+			It("should match the individual joint states",
+			   [this]
+			   {
+				   TUniquePtr<FPerJointHandTracker> HandTracker = MakeUnique<FPerJointHandTracker>();
+				   TestTrue("Joints available", HandTracker->GetAllJointStates(EControllerHand::Left, Orientations, Positions, Radii));
+
+				   for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+				   {
+					   FQuat Orientation;
+					   FVector Position;
+					   float Radius;
+					   HandTracker->GetJointState(EControllerHand::Left, (EHandKeypoint)Joint, Orientation, Position, Radius);
+					   TestTrue(FString::Printf(TEXT("Orientation %d"), Joint), Orientations[Joint].Equals(Orientation));
+					   TestEqual(FString::Printf(TEXT("Position %d"), Joint), Positions[Joint], Position);
+					   TestEqual(FString::Printf(TEXT("Radius %d"), Joint), Radii[Joint], Radius);
+				   }
+			   });
+
+			It("should not change the outputs if a joint is not available",
+			   [this]
+			   {
+				   TUniquePtr<FPerJointHandTracker> HandTracker = MakeUnique<FPerJointHandTracker>();
+				   HandTracker->NumAvailableJoints = EHandKeypointCount - 1;
+				   TestFalse("Joints available", HandTracker->GetAllJointStates(EControllerHand::Left, Orientations, Positions, Radii));
+
+				   for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+				   {
+					   TestEqual(FString::Printf(TEXT("Position %d"), Joint), Positions[Joint], FVector(-1, -1, -1));
+					   TestEqual(FString::Printf(TEXT("Radius %d"), Joint), Radii[Joint], -1.0f);
+				   }
+			   });
+		});
+
+	Describe(
+		"Test hand tracker batched joint states",
+		[this]
+		{
+			It("should match the individual joint states",
+			   [this]
+			   {
+				   TUniquePtr<FUxtTestHandTracker> HandTracker = MakeUnique<FUxtTestHandTracker>();
+				   HandTracker->SetJointPosition(FVector(1, 2, 3), EControllerHand::Right, EHandKeypoint::IndexTip);
+				   HandTracker->SetJointRadius(2.0f, EControllerHand::Right, EHandKeypoint::IndexTip);
+				   TestTrue("Joints available", HandTracker->GetAllJointStates(EControllerHand::Right, Orientations, Positions, Radii));
+
+				   const int32 IndexTip = (int32)EHandKeypoint::IndexTip;
+				   TestEqual("Index tip position", Positions[IndexTip], FVector(1, 2, 3));
+				   TestEqual("Index tip radius", Radii[IndexTip], 2.0f);
+				   TestEqual("Palm position", Positions[(int32)EHandKeypoint::Palm], FVector::ZeroVector);
+			   });
+
+			It("should not change the outputs if the hand is not tracked",
+			   [this]
+			   {
+				   TUniquePtr<FUxtTestHandTracker> HandTracker = MakeUnique<FUxtTestHandTracker>();
+				   HandTracker->SetTracked(false, EControllerHand::Right);
+				   TestFalse("Joints available", HandTracker->GetAllJointStates(EControllerHand::Right, Orientations, Positions, Radii));
+				   TestEqual("Palm position", Positions[(int32)EHandKeypoint::Palm], FVector(-1, -1, -1));
+			   });
+		});
+}
+
+#endif
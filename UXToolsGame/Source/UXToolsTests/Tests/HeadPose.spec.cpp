@@ -0,0 +1,117 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "FrameQueue.h"
+#include "UxtTestUtils.h"
+
+#include "Misc/AutomationTest.h"
+#include "Utils/UxtFunctionLibrary.h"
+#include "Utils/UxtHeadPoseSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	HeadPoseSpec, "UXTools.HeadPose", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+UWorld* World;
+UUxtHeadPoseSubsystem* HeadPoseSubsystem;
+FFrameQueue FrameQueue;
+
+const int32 NumMovingFrames = 10;
+
+END_DEFINE_SPEC(HeadPoseSpec)
+
+void HeadPoseSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			World = UxtTestUtils::LoadMap("/Game/UXToolsGame/Tests/Maps/TestEmpty");
+			TestNotNull("World", World);
+
+			HeadPoseSubsystem = World->GetSubsystem<UUxtHeadPoseSubsystem>();
+			TestNotNull("Head pose subsystem", HeadPoseSubsystem);
+
+			UxtTestUtils::EnableTestInputSystem();
+			UxtTestUtils::SetTestHeadLocation(FVector::ZeroVector);
+			UxtTestUtils::SetTestHeadRotation(FRotator::ZeroRotator);
+
+			FrameQueue.Init(&World->GetTimerManager());
+		});
+
+	AfterEach(
+		[this]
+		{
+			FrameQueue.Reset();
+			UxtTestUtils::DisableTestInputSystem();
+			UxtTestUtils::ExitGame();
+		});
+
+	It("should return the test head pose",
+	   [this]
+	   {
+		   const FVector Location(10, 20, 30);
+		   UxtTestUtils::SetTestHeadLocation(Location);
+
+		   TestEqual("Subsystem head location", HeadPoseSubsystem->GetHeadPose().GetLocation(), Location);
+		   TestEqual("Function library head location", UUxtFunctionLibrary::GetHeadPose(World).GetLocation(), Location);
+	   });
+
+	LatentIt(
+		"should estimate head velocity",
+		[this](const FDoneDelegate& Done)
+		{
+			for (int32 Frame = 1; Frame <= NumMovingFrames; ++Frame)
+			{
+				FrameQueue.Enqueue(
+					[Frame]
+					{
+						UxtTestUtils::SetTestHeadLocation(FVector(Frame, 0, 0));
+						UxtTestUtils::SetTestHeadRotation(FRotator(0, Frame, 0));
+					});
+			}
+
+			// Let the last pose be sampled
+			FrameQueue.Skip();
+
+			FrameQueue.Enqueue(
+				[this, Done]
+				{
+					const FVector LinearVelocity = HeadPoseSubsystem->GetHeadLinearVelocity();
+					TestTrue("Head is moving forward", LinearVelocity.X > 0.0f);
+					TestTrue("Head is moving along X only", LinearVelocity.GetSafeNormal().Equals(FVector::ForwardVector));
+
+					const FVector AngularVelocity = HeadPoseSubsystem->GetHeadAngularVelocity();
+					TestTrue("Head is turning", AngularVelocity.Z > 0.0f);
+					TestTrue("Head is turning around Z only", AngularVelocity.GetSafeNormal().Equals(FVector::UpVector));
+
+					const FTransform HeadPose = HeadPoseSubsystem->GetHeadPose();
+					TestTrue("Prediction without time is the head pose", HeadPoseSubsystem->PredictHeadPose(0.0f).Equals(HeadPose));
+
+					const FTransform Predicted = HeadPoseSubsystem->PredictHeadPose(UUxtHeadPoseSubsystem::MaxPredictionTime);
+					TestTrue("Predicted location is ahead", Predicted.GetLocation().X > HeadPose.GetLocation().X);
+					TestTrue("Predicted yaw is ahead", Predicted.Rotator().Yaw > HeadPose.Rotator().Yaw);
+
+					Done.Execute();
+				});
+		});
+
+	LatentIt(
+		"should report no velocity for a still head",
+		[this](const FDoneDelegate& Done)
+		{
+			FrameQueue.Skip(UUxtHeadPoseSubsystem::HistorySize);
+
+			FrameQueue.Enqueue(
+				[this, Done]
+				{
+					TestEqual("Linear velocity", HeadPoseSubsystem->GetHeadLinearVelocity(), FVector::ZeroVector);
+					TestEqual("Angular velocity", HeadPoseSubsystem->GetHeadAngularVelocity(), FVector::ZeroVector);
+					Done.Execute();
+				});
+		});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,143 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "FarTargetTestComponent.h"
+#include "UxtAllocationCounter.h"
+#include "UxtTestUtils.h"
+
+#include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
+#include "Interactions/UxtFarHandler.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	InputSubsystemSpec, "UXTools.InputSubsystem", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+AActor* Actor;
+UStaticMeshComponent* Mesh;
+UUxtFarPointerComponent* Pointer;
+UFarTargetReentrantTestComponent* ReentrantHandler;
+
+END_DEFINE_SPEC(InputSubsystemSpec)
+
+void InputSubsystemSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			Actor = World->SpawnActor<AActor>();
+			Mesh = UxtTestUtils::CreateStaticMesh(Actor);
+			Actor->SetRootComponent(Mesh);
+			Mesh->RegisterComponent();
+
+			ReentrantHandler = NewObject<UFarTargetReentrantTestComponent>(Actor);
+			ReentrantHandler->RegisterComponent();
+
+			// Only used as the source of the events, the pointer is not registered so that it does not raise events itself
+			Pointer = NewObject<UUxtFarPointerComponent>(Actor);
+		});
+
+	AfterEach(
+		[this]
+		{
+			UUxtInputSubsystem::UnregisterHandler(ReentrantHandler, UUxtFarHandler::StaticClass());
+			Actor->Destroy();
+			Actor = nullptr;
+			Mesh = nullptr;
+			Pointer = nullptr;
+			ReentrantHandler = nullptr;
+		});
+
+	Describe(
+		"Handler changes during dispatch",
+		[this]
+		{
+			It("should dispatch to added handlers from the next event",
+			   [this]
+			   {
+				   ReentrantHandler->bAddHandler = true;
+
+				   UUxtInputSubsystem::RaiseEnterFarFocus(Mesh, Pointer);
+				   UFarTargetTestComponent* AddedHandler = ReentrantHandler->AddedHandler;
+				   if (!TestNotNull("Added handler", AddedHandler))
+				   {
+					   return;
+				   }
+				   TestEqual("Enter events", ReentrantHandler->NumEnter, 1);
+				   TestEqual("Added handler enter events", AddedHandler->NumEnter, 0);
+
+				   UUxtInputSubsystem::RaiseEnterFarFocus(Mesh, Pointer);
+				   TestEqual("Enter events after next event", ReentrantHandler->NumEnter, 2);
+				   TestEqual("Added handler enter events after next event", AddedHandler->NumEnter, 1);
+			   });
+
+			It("should not dispatch to destroyed handlers",
+			   [this]
+			   {
+				   UFarTargetTestComponent* OtherHandler = NewObject<UFarTargetTestComponent>(Actor);
+				   OtherHandler->RegisterComponent();
+				   ReentrantHandler->HandlerToDestroy = OtherHandler;
+
+				   // Global listeners are dispatched first, the other handler is destroyed before it receives the event
+				   UUxtInputSubsystem::RegisterHandler(ReentrantHandler, UUxtFarHandler::StaticClass());
+
+				   UUxtInputSubsystem::RaiseEnterFarFocus(Mesh, Pointer);
+				   TestEqual("Enter events", ReentrantHandler->NumEnter, 1);
+				   TestEqual("Destroyed handler enter events", OtherHandler->NumEnter, 0);
+
+				   UUxtInputSubsystem::RaiseEnterFarFocus(Mesh, Pointer);
+				   TestEqual("Enter events after next event", ReentrantHandler->NumEnter, 2);
+				   TestEqual("Destroyed handler enter events after next event", OtherHandler->NumEnter, 0);
+			   });
+		});
+
+	Describe(
+		"Dispatch allocations",
+		[this]
+		{
+			It("should not allocate when raising nested events on an actor with many handlers",
+			   [this]
+			   {
+				   // More handlers than the inline storage of the registry component lists
+				   TArray<UFarTargetTestComponent*> Handlers;
+				   for (int32 Index = 0; Index < 9; ++Index)
+				   {
+					   UFarTargetTestComponent* Handler = NewObject<UFarTargetTestComponent>(Actor);
+					   Handler->RegisterComponent();
+					   Handlers.Add(Handler);
+				   }
+				   ReentrantHandler->NestedEventTarget = Mesh;
+
+				   // The first event builds the registry cache and the dispatch buffers of both nesting levels
+				   UUxtInputSubsystem::RaiseEnterFarFocus(Mesh, Pointer);
+
+				   const int32 NumEvents = 100;
+				   FUxtAllocationCounter AllocationCounter;
+				   AllocationCounter.Start();
+				   for (int32 Event = 0; Event < NumEvents; ++Event)
+				   {
+					   UUxtInputSubsystem::RaiseEnterFarFocus(Mesh, Pointer);
+				   }
+				   AllocationCounter.Stop();
+
+				   TestEqual("Allocations", AllocationCounter.GetNumAllocations(), 0);
+				   TestEqual("Allocated bytes", AllocationCounter.GetNumBytes(), (int64)0);
+
+				   for (UFarTargetTestComponent* Handler : Handlers)
+				   {
+					   TestEqual("Handler enter events", Handler->NumEnter, NumEvents + 1);
+					   TestEqual("Handler nested update events", Handler->NumUpdated, NumEvents + 1);
+				   }
+			   });
+		});
+}
+
+#endif
@@ -204,6 +204,76 @@ void ManipulatorConstraintSpec::Define()
 
 					FrameQueue.Enqueue([Done] { Done.Execute(); });
 				});
+
+			LatentIt(
+				"should stop applying unregistered constraints",
+				[this](const FDoneDelegate& Done)
+				{
+					Target->SetAutoDetectConstraints(true);
+					Constraint->DestroyComponent();
+
+					const FTransform InitialTransform = Target->GetOwner()->GetTransform();
+
+					FrameQueue.Enqueue([this] { RightHand.SetGrabbing(true); });
+
+					FrameQueue.Enqueue(
+						[this]
+						{
+							TestTrue("Component is grabbed", Target->GetGrabPointers().Num() > 0);
+
+							RightHand.Translate(FVector(10, 10, 10));
+						});
+
+					// Skip a frame to ensure the manipulator has updated the object.
+					FrameQueue.Skip();
+
+					FrameQueue.Enqueue(
+						[this, InitialTransform]
+						{
+							const FTransform Result = Target->GetOwner()->GetTransform();
+
+							TestNotEqual("The movement constraint was not applied", Result.GetLocation(), InitialTransform.GetLocation());
+						});
+
+					FrameQueue.Enqueue([Done] { Done.Execute(); });
+				});
+
+			LatentIt(
+				"should apply constraints registered during manipulation",
+				[this](const FDoneDelegate& Done)
+				{
+					Target->SetAutoDetectConstraints(true);
+					Constraint->DestroyComponent();
+
+					FrameQueue.Enqueue([this] { RightHand.SetGrabbing(true); });
+
+					FrameQueue.Enqueue(
+						[this]
+						{
+							TestTrue("Component is grabbed", Target->GetGrabPointers().Num() > 0);
+
+							UUxtMoveAxisConstraint* MoveConstraint = NewObject<UUxtMoveAxisConstraint>(Target->GetOwner());
+							MoveConstraint->ConstraintOnMovement =
+								static_cast<uint32>(EUxtAxisFlags::X | EUxtAxisFlags::Y | EUxtAxisFlags::Z);
+							MoveConstraint->RegisterComponent();
+
+							PositionCache = Target->GetOwner()->GetActorLocation();
+							RightHand.Translate(FVector(10, 10, 10));
+						});
+
+					// Skip a frame to ensure the manipulator has updated the object.
+					FrameQueue.Skip();
+
+					FrameQueue.Enqueue(
+						[this]
+						{
+							const FVector Result = Target->GetOwner()->GetActorLocation();
+
+							TestEqual("The movement constraint was applied", Result, PositionCache);
+						});
+
+					FrameQueue.Enqueue([Done] { Done.Execute(); });
+				});
 		});
 
 	Describe(
@@ -131,6 +131,7 @@ void ExpectGrabTargetNone();
 void ExpectPokeTargetIndex(int TargetIndex);
 void ExpectPokeTargetNone();
 void AddGrabKeyframe(bool bEnableGrab);
+void AddWaitKeyframe(float Seconds);
 
 FFrameQueue FrameQueue;
 TArray<UUxtNearPointerComponent*> Pointers;
@@ -223,6 +224,20 @@ void NearPointerPokeSpec::AddMovementKeyframe(const FVector& PointerLocation)
 	FrameQueue.Enqueue([PointerLocation] { UxtTestUtils::GetTestHandTracker().SetAllJointPositions(PointerLocation); });
 }
 
+void NearPointerPokeSpec::AddWaitKeyframe(float Seconds)
+{
+	FrameQueue.Enqueue(
+		[this, Seconds]
+		{
+			// Pause the queue until the time has passed in the world, the pointers keep ticking meanwhile
+			FrameQueue.Pause();
+
+			FTimerHandle DummyHandle;
+			UxtTestUtils::GetTestWorld()->GetTimerManager().SetTimer(
+				DummyHandle, FTimerDelegate::CreateLambda([this] { FrameQueue.Resume(); }), Seconds, false);
+		});
+}
+
 void NearPointerPokeSpec::ExpectFocusTargetIndex(int NewFocusTargetIndex)
 {
 	FrameQueue.Enqueue(
@@ -479,6 +494,88 @@ void NearPointerPokeSpec::Define()
 					FrameQueue.Enqueue([Done] { Done.Execute(); });
 				});
 
+			LatentIt(
+				"should focus targets found through the target registry",
+				[this](const FDoneDelegate& Done)
+				{
+					for (UUxtNearPointerComponent* Pointer : Pointers)
+					{
+						Pointer->bUseTargetRegistry = true;
+					}
+
+					FVector p1(120, -40, -5);
+					FVector p2(100, 30, 15);
+					AddTarget(p1);
+					AddTarget(p2);
+
+					AddMovementKeyframe(FocusStartLocation);
+					ExpectFocusTargetNone();
+					AddMovementKeyframe(p1);
+					ExpectFocusTargetIndex(0);
+					AddMovementKeyframe(p2);
+					ExpectFocusTargetIndex(1);
+					AddMovementKeyframe(FocusEndLocation);
+					ExpectFocusTargetNone();
+
+					FrameQueue.Enqueue([Done] { Done.Execute(); });
+				});
+
+			LatentIt(
+				"should focus targets when reusing proximity queries",
+				[this](const FDoneDelegate& Done)
+				{
+					for (UUxtNearPointerComponent* Pointer : Pointers)
+					{
+						Pointer->bReuseProximityQuery = true;
+					}
+
+					FVector p1(120, -40, -5);
+					FVector p2(100, 30, 15);
+					AddTarget(p1);
+					AddTarget(p2);
+
+					AddMovementKeyframe(FocusStartLocation);
+					ExpectFocusTargetNone();
+					AddMovementKeyframe(p1);
+					ExpectFocusTargetIndex(0);
+					AddMovementKeyframe(p1 + FVector(0.5f, 0, 0));
+					ExpectFocusTargetIndex(0);
+					AddMovementKeyframe(p2);
+					ExpectFocusTargetIndex(1);
+					AddMovementKeyframe(FocusEndLocation);
+					ExpectFocusTargetNone();
+
+					FrameQueue.Enqueue([Done] { Done.Execute(); });
+				});
+
+			LatentIt(
+				"should focus targets when using async proximity queries",
+				[this](const FDoneDelegate& Done)
+				{
+					for (UUxtNearPointerComponent* Pointer : Pointers)
+					{
+						Pointer->bUseAsyncProximityQuery = true;
+					}
+
+					FVector p1(120, -40, -5);
+					FVector p2(100, 30, 15);
+					AddTarget(p1);
+					AddTarget(p2);
+
+					AddMovementKeyframe(FocusStartLocation);
+					ExpectFocusTargetNone();
+					AddMovementKeyframe(p1);
+					ExpectFocusTargetIndex(0);
+					AddMovementKeyframe(p1 + FVector(0.5f, 0, 0));
+					ExpectFocusTargetIndex(0);
+					AddMovementKeyframe(p2);
+					ExpectFocusTargetIndex(1);
+					AddMovementKeyframe(FocusEndLocation);
+					ExpectFocusTargetNone();
+
+					FrameQueue.Enqueue([Done] { Done.Execute(); });
+				});
+
 			LatentIt(
 				"should focus two overlapping targets",
 				[this](const FDoneDelegate& Done)
@@ -500,6 +597,64 @@ void NearPointerPokeSpec::Define()
 					FrameQueue.Enqueue([Done] { Done.Execute(); });
 				});
 
+			LatentIt(
+				"should keep focus within the focus switch margin",
+				[this](const FDoneDelegate& Done)
+				{
+					for (UUxtNearPointerComponent* Pointer : Pointers)
+					{
+						Pointer->FocusSwitchMargin = 100.0f;
+					}
+
+					FVector p1(110, 4, -5);
+					FVector p2(115, 12, -2);
+					AddTarget(p1);
+					AddTarget(p2);
+
+					AddMovementKeyframe(FocusStartLocation);
+					ExpectFocusTargetNone();
+					AddMovementKeyframe(p1 + FVector(0, -10, 0));
+					ExpectFocusTargetIndex(0);
+					AddMovementKeyframe(p2 + FVector(0, 10, 0));
+					ExpectFocusTargetIndex(0);
+					AddMovementKeyframe(FocusEndLocation);
+					ExpectFocusTargetNone();
+
+					FrameQueue.Enqueue([Done] { Done.Execute(); });
+				});
+
+			LatentIt(
+				"should switch focus after the focus switch dwell time",
+				[this](const FDoneDelegate& Done)
+				{
+					const float DwellTime = 0.25f;
+					for (UUxtNearPointerComponent* Pointer : Pointers)
+					{
+						Pointer->FocusSwitchDwellTime = DwellTime;
+					}
+
+					FVector p1(110, 4, -5);
+					FVector p2(115, 12, -2);
+					AddTarget(p1);
+					AddTarget(p2);
+
+					AddMovementKeyframe(FocusStartLocation);
+					ExpectFocusTargetNone();
+					AddMovementKeyframe(p1 + FVector(0, -10, 0));
+					ExpectFocusTargetIndex(0);
+
+					// The second target is closest but has not been for the dwell time yet
+					AddMovementKeyframe(p2 + FVector(0, 10, 0));
+					ExpectFocusTargetIndex(0);
+
+					AddWaitKeyframe(DwellTime * 2.0f);
+					ExpectFocusTargetIndex(1);
+					AddMovementKeyframe(FocusEndLocation);
+					ExpectFocusTargetNone();
+
+					FrameQueue.Enqueue([Done] { Done.Execute(); });
+				});
+
 			LatentIt(
 				"should focus grab target when overlapping initially",
 				[this](const FDoneDelegate& Done)
@@ -609,6 +764,59 @@ void NearPointerPokeSpec::Define()
 
 					FrameQueue.Enqueue([Done] { Done.Execute(); });
 				});
+			LatentIt(
+				"should poke with additional poke joints",
+				[this](const FDoneDelegate& Done)
+				{
+					UWorld* World = UxtTestUtils::GetTestWorld();
+					PointerTargetState& Target = AddTarget(FVector(200, 0, 0), ETestTargetKind::Poke);
+					UTestPokeTarget* PokeTarget = Target.GetPokeTarget();
+
+					// Finger pointers are created on begin play, configure the joints before registering the pointer
+					AActor* PointerActor = World->SpawnActor<AActor>();
+					UUxtNearPointerComponent* Pointer = NewObject<UUxtNearPointerComponent>(PointerActor);
+					Pointer->AdditionalPokeJoints.Add(EHandKeypoint::MiddleTip);
+					Pointer->RegisterComponent();
+
+					TestEqual("Finger pointer count", Pointer->GetFingerPointers().Num(), 1);
+					UUxtNearPointerComponent* FingerPointer = Pointer->GetFingerPointers()[0];
+					TestTrue("Finger pointer has primary pointer", FingerPointer->GetPrimaryPointer() == Pointer);
+					TestTrue("Primary pointer is not a finger pointer", Pointer->GetPrimaryPointer() == nullptr);
+
+					// Keep the index tips of all pointers away from the target, only the middle tip pokes
+					FrameQueue.Enqueue(
+						[this]
+						{
+							UxtTestUtils::GetTestHandTracker().SetAllJointPositions(FocusStartLocation);
+							UxtTestUtils::GetTestHandTracker().SetJointPosition(
+								PokeInitialPosition, EControllerHand::AnyHand, EHandKeypoint::MiddleTip);
+						});
+					FrameQueue.Enqueue(
+						[this, PokeTarget, Pointer, FingerPointer]
+						{
+							FVector ClosestPoint, Normal;
+							UObject* FocusedTarget = FingerPointer->GetFocusedPokeTarget(ClosestPoint, Normal);
+							TestTrue("Finger pointer focuses target", FocusedTarget == PokeTarget);
+							TestTrue("Primary pointer has no focus", Pointer->GetFocusTarget() == nullptr);
+							TestEqual("Target focus count", PokeTarget->BeginFocusCount, 1);
+							TestEqual("Target poke count", PokeTarget->BeginPokeCount, 0);
+
+							UxtTestUtils::GetTestHandTracker().SetJointPosition(
+								PokeFinalPosition, EControllerHand::AnyHand, EHandKeypoint::MiddleTip);
+						});
+					FrameQueue.Enqueue(
+						[this, PokeTarget, FingerPointer]
+						{
+							TestTrue("Finger pointer is poking", FingerPointer->GetIsPoking());
+							TestEqual("Target poke count", PokeTarget->BeginPokeCount, 1);
+						});
+					FrameQueue.Enqueue(
+						[PointerActor, Done]
+						{
+							PointerActor->Destroy();
+							Done.Execute();
+						});
+				});
 		});
 }
 
@@ -0,0 +1,80 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "FrameQueue.h"
+#include "UxtTestUtils.h"
+
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "Misc/AutomationTest.h"
+#include "Utils/UxtParameterCollectionSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	ParameterCollectionSpec, "UXTools.ParameterCollection",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+UWorld* World;
+UUxtParameterCollectionSubsystem* ParameterCollection;
+FFrameQueue FrameQueue;
+
+END_DEFINE_SPEC(ParameterCollectionSpec)
+
+void ParameterCollectionSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			World = UxtTestUtils::LoadMap("/Game/UXToolsGame/Tests/Maps/TestEmpty");
+			TestNotNull("World", World);
+
+			ParameterCollection = World->GetSubsystem<UUxtParameterCollectionSubsystem>();
+			TestNotNull("Parameter collection subsystem", ParameterCollection);
+
+			FrameQueue.Init(&World->GetTimerManager());
+		});
+
+	AfterEach(
+		[this]
+		{
+			FrameQueue.Reset();
+			UxtTestUtils::ExitGame();
+		});
+
+	It("should resolve pointer parameters",
+	   [this]
+	   {
+		   TestNotEqual("Left pointer index", ParameterCollection->FindVectorParameter("LeftPointerPosition"), INDEX_NONE);
+		   TestNotEqual("Right pointer index", ParameterCollection->FindVectorParameter("RightPointerPosition"), INDEX_NONE);
+		   TestEqual("Unknown parameter index", ParameterCollection->FindVectorParameter("UnknownParameter"), INDEX_NONE);
+	   });
+
+	LatentIt(
+		"should serve written values from the buffer and commit them at the end of the frame",
+		[this](const FDoneDelegate& Done)
+		{
+			const FVector Position(10, 20, 30);
+			ParameterCollection->SetPointerPosition(EControllerHand::Left, Position);
+
+			FVector BufferedPosition;
+			TestTrue("Left pointer parameter exists", ParameterCollection->GetPointerPosition(EControllerHand::Left, BufferedPosition));
+			TestEqual("Buffered position", BufferedPosition, Position);
+
+			FrameQueue.Enqueue(
+				[this, Position, Done]
+				{
+					UMaterialParameterCollectionInstance* Instance =
+						World->GetParameterCollectionInstance(ParameterCollection->GetParameterCollection());
+
+					FLinearColor CommittedPosition;
+					TestTrue("Parameter found", Instance->GetVectorParameterValue("LeftPointerPosition", CommittedPosition));
+					TestEqual("Committed position", FVector(CommittedPosition), Position);
+					Done.Execute();
+				});
+		});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
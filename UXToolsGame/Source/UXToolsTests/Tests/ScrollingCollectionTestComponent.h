@@ -0,0 +1,32 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Components/ActorComponent.h"
+
+#include "ScrollingCollectionTestComponent.generated.h"
+
+/**
+ * Data source for virtualized scrolling collection tests that records item bindings.
+ */
+UCLASS(ClassGroup = "UXToolsTests")
+class UScrollingCollectionTestComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(Category = "UXToolsTests")
+	void OnBindItem(AActor* ItemActor, int32 ItemIndex)
+	{
+		BoundActors.Add(ItemIndex, ItemActor);
+		BindCount++;
+	}
+
+	/** Last actor bound to each item. */
+	TMap<int32, AActor*> BoundActors;
+
+	int BindCount = 0;
+};
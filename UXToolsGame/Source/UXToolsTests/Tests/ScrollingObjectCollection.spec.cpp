@@ -0,0 +1,165 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "EngineUtils.h"
+#include "FrameQueue.h"
+#include "ScrollingCollectionTestComponent.h"
+#include "UxtTestUtils.h"
+
+#include "Controls/UxtScrollingObjectCollection.h"
+#include "Engine/StaticMeshActor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const int32 NumItems = 20;
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	ScrollingObjectCollectionSpec, "UXTools.ScrollingObjectCollection",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+AActor* Actor;
+UUxtScrollingObjectCollection* Collection;
+UScrollingCollectionTestComponent* DataSource;
+FFrameQueue FrameQueue;
+
+int32 GetNumPooledActors() const;
+
+END_DEFINE_SPEC(ScrollingObjectCollectionSpec)
+
+int32 ScrollingObjectCollectionSpec::GetNumPooledActors() const
+{
+	// Pooled actors are spawned with the collection's owner
+	int32 NumPooledActors = 0;
+	for (TActorIterator<AStaticMeshActor> It(UxtTestUtils::GetTestWorld()); It; ++It)
+	{
+		if (It->GetOwner() == Actor)
+		{
+			++NumPooledActors;
+		}
+	}
+	return NumPooledActors;
+}
+
+void ScrollingObjectCollectionSpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			FrameQueue.Init(&World->GetGameInstance()->GetTimerManager());
+
+			Actor = World->SpawnActor<AActor>();
+			Collection = NewObject<UUxtScrollingObjectCollection>(Actor);
+			Actor->SetRootComponent(Collection);
+			Collection->RegisterComponent();
+
+			DataSource = NewObject<UScrollingCollectionTestComponent>(Actor);
+			DataSource->RegisterComponent();
+
+			// Default collection shows 4 lines of 2 items, with a margin of 1 line on each side
+			FUxtScrollingObjectCollectionBindItem BindItem;
+			BindItem.BindDynamic(DataSource, &UScrollingCollectionTestComponent::OnBindItem);
+			Collection->SetVirtualizedDataSource(AStaticMeshActor::StaticClass(), NumItems, BindItem);
+		});
+
+	AfterEach(
+		[this]
+		{
+			Actor->Destroy();
+			Actor = nullptr;
+			Collection = nullptr;
+			DataSource = nullptr;
+
+			FrameQueue.Reset();
+		});
+
+	It("should bind pooled actors to the visible items and margin",
+	   [this]
+	   {
+		   TestTrue("Collection is virtualized", Collection->IsVirtualized());
+		   TestEqual("Bind count", DataSource->BindCount, 10);
+		   TestEqual("Pooled actors", GetNumPooledActors(), 10);
+
+		   for (int32 ItemIndex = 0; ItemIndex < 10; ++ItemIndex)
+		   {
+			   AActor* ItemActor = Collection->GetItemActor(ItemIndex);
+			   TestNotNull(FString::Printf(TEXT("Item %d actor"), ItemIndex), ItemActor);
+			   TestEqual(FString::Printf(TEXT("Item %d bound actor"), ItemIndex), DataSource->BoundActors.FindRef(ItemIndex), ItemActor);
+		   }
+		   TestNull("Item outside of margin", Collection->GetItemActor(10));
+
+		   TestFalse("Visible item hidden", Collection->GetItemActor(0)->IsHidden());
+		   TestTrue("Margin item hidden", Collection->GetItemActor(8)->IsHidden());
+	   });
+
+	LatentIt(
+		"should recycle actors when scrolling",
+		[this](const FDoneDelegate& Done)
+		{
+			AActor* FirstItemActor = Collection->GetItemActor(0);
+			Collection->SetComponentTickEnabled(true);
+			Collection->MoveByItems(2, false, FUxtScrollingObjectCollectionOnPaginationEnd());
+
+			FrameQueue.Skip(2);
+			FrameQueue.Enqueue(
+				[this, Done, FirstItemActor]
+				{
+					// Lines 2 to 5 are visible, lines 1 and 6 are in the margin
+					TestNull("First item actor after scrolling", Collection->GetItemActor(0));
+					TestNull("Second item actor after scrolling", Collection->GetItemActor(1));
+					TestNotNull("Last bound item actor after scrolling", Collection->GetItemActor(13));
+					TestNull("Item outside of margin after scrolling", Collection->GetItemActor(14));
+					TestFalse("Visible item hidden after scrolling", Collection->GetItemActor(4)->IsHidden());
+
+					bool bFirstItemActorRecycled = false;
+					for (int32 ItemIndex = 10; ItemIndex < 14; ++ItemIndex)
+					{
+						bFirstItemActorRecycled |= Collection->GetItemActor(ItemIndex) == FirstItemActor;
+					}
+					TestTrue("First item actor recycled", bFirstItemActorRecycled);
+					TestEqual("Pooled actors after scrolling", GetNumPooledActors(), 12);
+					TestEqual("Bind count after scrolling", DataSource->BindCount, 14);
+					Done.Execute();
+				});
+		});
+
+	It("should shrink the pool when the item count drops",
+	   [this]
+	   {
+		   Collection->SetVirtualizedItemCount(3);
+		   TestEqual("Pooled actors", GetNumPooledActors(), 3);
+		   TestNotNull("Last item actor", Collection->GetItemActor(2));
+		   TestNull("Removed item actor", Collection->GetItemActor(3));
+
+		   Collection->SetVirtualizedItemCount(NumItems);
+		   TestEqual("Pooled actors after growing", GetNumPooledActors(), 10);
+		   TestNotNull("Added item actor", Collection->GetItemActor(9));
+	   });
+
+	It("should rebind items when the item count changes",
+	   [this]
+	   {
+		   DataSource->BoundActors.Empty();
+		   Collection->SetVirtualizedItemCount(NumItems - 1);
+		   TestEqual("Rebound items", DataSource->BoundActors.Num(), 10);
+		   TestEqual("Rebound actor", DataSource->BoundActors.FindRef(0), Collection->GetItemActor(0));
+	   });
+
+	It("should destroy pooled actors when the collection is destroyed",
+	   [this]
+	   {
+		   Collection->DestroyComponent();
+		   TestEqual("Pooled actors", GetNumPooledActors(), 0);
+	   });
+}
+
+#endif
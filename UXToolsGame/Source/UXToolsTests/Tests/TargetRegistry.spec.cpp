@@ -0,0 +1,206 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "Engine.h"
+#include "UxtTestTargetComponent.h"
+#include "UxtTestUtils.h"
+
+#include "Components/BoxComponent.h"
+#include "Input/UxtTargetRegistrySubsystem.h"
+#include "Interactions/UxtGrabTarget.h"
+#include "Interactions/UxtGrabTargetComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	UTestGrabTarget* AddGrabTarget(AActor* Actor)
+	{
+		UTestGrabTarget* Target = NewObject<UTestGrabTarget>(Actor);
+		Target->RegisterComponent();
+		return Target;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	TargetRegistrySpec, "UXTools.TargetRegistry", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+UUxtTargetRegistrySubsystem* Registry;
+AActor* Actor;
+
+bool TestGrabTargets(const TCHAR* What, AActor* InActor, const TArray<UActorComponent*>& Expected);
+
+END_DEFINE_SPEC(TargetRegistrySpec)
+
+bool TargetRegistrySpec::TestGrabTargets(const TCHAR* What, AActor* InActor, const TArray<UActorComponent*>& Expected)
+{
+	const FUxtComponentList& Components = Registry->GetCachedComponents(InActor, UUxtGrabTarget::StaticClass());
+
+	TArray<UActorComponent*> Actual;
+	for (const TWeakObjectPtr<UActorComponent>& Component : Components)
+	{
+		Actual.Add(Component.Get());
+	}
+
+	bool bResult = TestEqual(FString::Printf(TEXT("%s count"), What), Actual.Num(), Expected.Num());
+	for (UActorComponent* Component : Expected)
+	{
+		bResult &= TestTrue(FString::Printf(TEXT("%s contains %s"), What, *Component->GetName()), Actual.Contains(Component));
+	}
+	return bResult;
+}
+
+void TargetRegistrySpec::Define()
+{
+	BeforeEach(
+		[this]
+		{
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			Registry = World->GetSubsystem<UUxtTargetRegistrySubsystem>();
+			TestNotNull("Target registry", Registry);
+
+			Actor = World->SpawnActor<AActor>();
+			UStaticMeshComponent* Mesh = UxtTestUtils::CreateStaticMesh(Actor);
+			Actor->SetRootComponent(Mesh);
+			Mesh->RegisterComponent();
+		});
+
+	AfterEach(
+		[this]
+		{
+			Actor->Destroy();
+			Actor = nullptr;
+			Registry = nullptr;
+		});
+
+	Describe(
+		"Cached components",
+		[this]
+		{
+			It("should include added components",
+			   [this]
+			   {
+				   TestGrabTargets(TEXT("Before adding"), Actor, {});
+
+				   UTestGrabTarget* Target = AddGrabTarget(Actor);
+				   TestGrabTargets(TEXT("After adding"), Actor, {Target});
+			   });
+
+			It("should exclude removed components",
+			   [this]
+			   {
+				   UTestGrabTarget* Target = AddGrabTarget(Actor);
+				   TestGrabTargets(TEXT("Before removing"), Actor, {Target});
+
+				   Target->DestroyComponent();
+				   TestGrabTargets(TEXT("After removing"), Actor, {});
+			   });
+
+			It("should follow replaced UXT target components",
+			   [this]
+			   {
+				   UUxtGrabTargetComponent* Target = NewObject<UUxtGrabTargetComponent>(Actor);
+				   Target->RegisterComponent();
+				   TestGrabTargets(TEXT("Before replacing"), Actor, {Target});
+
+				   // Replace the target within the frame so that the number of components does not change
+				   Target->DestroyComponent();
+				   UUxtGrabTargetComponent* NewTarget = NewObject<UUxtGrabTargetComponent>(Actor);
+				   NewTarget->RegisterComponent();
+				   TestGrabTargets(TEXT("After replacing"), Actor, {NewTarget});
+			   });
+
+			It("should follow replaced components once the actor is invalidated",
+			   [this]
+			   {
+				   UTestGrabTarget* Target = AddGrabTarget(Actor);
+				   TestGrabTargets(TEXT("Before replacing"), Actor, {Target});
+
+				   // Other components are only compared once per frame unless the number of components changes
+				   Target->DestroyComponent();
+				   UTestGrabTarget* NewTarget = AddGrabTarget(Actor);
+				   Registry->InvalidateActor(Actor);
+				   TestGrabTargets(TEXT("After replacing"), Actor, {NewTarget});
+			   });
+
+			It("should follow components moved to another actor",
+			   [this]
+			   {
+				   AActor* OtherActor = UxtTestUtils::GetTestWorld()->SpawnActor<AActor>();
+				   UTestGrabTarget* Target = AddGrabTarget(Actor);
+				   TestGrabTargets(TEXT("Before moving, source"), Actor, {Target});
+				   TestGrabTargets(TEXT("Before moving, destination"), OtherActor, {});
+
+				   Target->UnregisterComponent();
+				   Target->Rename(nullptr, OtherActor);
+				   Target->RegisterComponent();
+
+				   TestGrabTargets(TEXT("After moving, source"), Actor, {});
+				   TestGrabTargets(TEXT("After moving, destination"), OtherActor, {Target});
+
+				   OtherActor->Destroy();
+			   });
+		});
+
+	Describe(
+		"Proximity queries",
+		[this]
+		{
+			It("should follow grab target components added at runtime",
+			   [this]
+			   {
+				   UPrimitiveComponent* Mesh = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+				   const FVector Center = Mesh->GetComponentLocation();
+				   TArray<UPrimitiveComponent*> Primitives;
+
+				   // Primitives are registered already, the actor does not own a target yet
+				   Registry->QueryProximity(Center, 1.0f, ECC_Visibility, Primitives);
+				   TestFalse("Mesh found before adding", Primitives.Contains(Mesh));
+
+				   UUxtGrabTargetComponent* Target = NewObject<UUxtGrabTargetComponent>(Actor);
+				   Target->RegisterComponent();
+				   Registry->QueryProximity(Center, 1.0f, ECC_Visibility, Primitives);
+				   TestTrue("Mesh found after adding", Primitives.Contains(Mesh));
+
+				   Target->DestroyComponent();
+				   Registry->QueryProximity(Center, 1.0f, ECC_Visibility, Primitives);
+				   TestFalse("Mesh found after removing", Primitives.Contains(Mesh));
+			   });
+		});
+
+	Describe(
+		"Poke geometry",
+		[this]
+		{
+			It("should be rebuilt when the primitive extent changes",
+			   [this]
+			   {
+				   UBoxComponent* Box = NewObject<UBoxComponent>(Actor);
+				   Box->SetBoxExtent(FVector(10, 20, 30));
+				   Box->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+				   Box->SetupAttachment(Actor->GetRootComponent());
+				   Box->RegisterComponent();
+
+				   const FUxtPokeGeometry Geometry = Registry->GetPokeGeometry(Box);
+				   TestTrue("Box shape", Geometry.Shape == FUxtPokeGeometry::EShape::Box);
+				   TestEqual("Extent", Geometry.LocalBounds.BoxExtent, FVector(10, 20, 30));
+				   TestEqual("Front face", Geometry.FrontFace.W, 10.0f);
+
+				   Box->SetBoxExtent(FVector(40, 20, 30));
+
+				   const FUxtPokeGeometry ResizedGeometry = Registry->GetPokeGeometry(Box);
+				   TestEqual("Resized extent", ResizedGeometry.LocalBounds.BoxExtent, FVector(40, 20, 30));
+				   TestEqual("Resized front face", ResizedGeometry.FrontFace.W, 40.0f);
+
+				   // Copies are not affected by later changes
+				   TestEqual("Copied extent", Geometry.LocalBounds.BoxExtent, FVector(10, 20, 30));
+			   });
+		});
+}
+
+#endif
@@ -0,0 +1,108 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "UxtAllocationCounter.h"
+
+#include "HAL/MemoryBase.h"
+#include "HAL/ThreadSafeBool.h"
+
+namespace
+{
+	/** Allocator forwarding to the previous GMalloc and counting game thread allocations while enabled. */
+	class FCountingMalloc : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc) {}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return InnerMalloc->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+
+		/** Only read and written on the game thread. */
+		int32 NumAllocations = 0;
+		int64 NumBytes = 0;
+
+		FThreadSafeBool bCounting;
+
+	private:
+		void CountAllocation(SIZE_T Count)
+		{
+			if (bCounting && Count > 0 && IsInGameThread())
+			{
+				++NumAllocations;
+				NumBytes += Count;
+			}
+		}
+
+		FMalloc* InnerMalloc;
+	};
+
+	FCountingMalloc& GetCountingMalloc()
+	{
+		check(IsInGameThread());
+
+		// Intentionally leaked, other threads may call into it at any time once installed.
+		static FCountingMalloc* CountingMalloc = nullptr;
+		if (!CountingMalloc)
+		{
+			CountingMalloc = new FCountingMalloc(GMalloc);
+			FPlatformMisc::MemoryBarrier();
+			GMalloc = CountingMalloc;
+		}
+		return *CountingMalloc;
+	}
+} // namespace
+
+void FUxtAllocationCounter::Start()
+{
+	FCountingMalloc& CountingMalloc = GetCountingMalloc();
+	check(!CountingMalloc.bCounting);
+
+	CountingMalloc.NumAllocations = 0;
+	CountingMalloc.NumBytes = 0;
+	CountingMalloc.bCounting = true;
+}
+
+void FUxtAllocationCounter::Stop()
+{
+	FCountingMalloc& CountingMalloc = GetCountingMalloc();
+	CountingMalloc.bCounting = false;
+
+	NumAllocations = CountingMalloc.NumAllocations;
+	NumBytes = CountingMalloc.NumBytes;
+}
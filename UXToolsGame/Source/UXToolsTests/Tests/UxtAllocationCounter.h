@@ -0,0 +1,33 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counts the heap allocations made on the game thread between Start and Stop.
+ *
+ * The first use installs a forwarding allocator in place of GMalloc. It is never removed or destroyed, so threads that
+ * are allocating while it is installed, or that still use the previous allocator, keep working on the same heap.
+ * Allocations from other threads are forwarded without being counted.
+ */
+class FUxtAllocationCounter
+{
+public:
+	/** Start counting game thread allocations. Counters cannot be nested. */
+	void Start();
+
+	/** Stop counting and keep the totals since Start. */
+	void Stop();
+
+	/** Number of allocations and reallocations counted. */
+	int32 GetNumAllocations() const { return NumAllocations; }
+
+	/** Number of bytes requested by the counted allocations. */
+	int64 GetNumBytes() const { return NumBytes; }
+
+private:
+	int32 NumAllocations = 0;
+	int64 NumBytes = 0;
+};
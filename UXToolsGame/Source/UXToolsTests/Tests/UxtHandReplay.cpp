@@ -0,0 +1,165 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "UxtHandReplay.h"
+
+#include "UxtTestHandTracker.h"
+#include "UxtTestUtils.h"
+
+#include "Engine/World.h"
+
+namespace
+{
+	void ApplyHandState(FUxtTestHandTracker& HandTracker, const FUxtRecordedHandState& State, EControllerHand Hand)
+	{
+		HandTracker.SetTracked(State.bIsTracked, Hand);
+		HandTracker.SetJointsAvailable(State.bHasJoints, Hand);
+		HandTracker.SetPointerPoseAvailable(State.bHasPointerPose, Hand);
+		HandTracker.SetGripPoseAvailable(State.bHasGripPose, Hand);
+		HandTracker.SetGrabbing(State.bIsGrabbing, Hand);
+		HandTracker.SetSelectPressed(State.bIsSelectPressed, Hand);
+
+		if (State.bHasJoints)
+		{
+			for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+			{
+				HandTracker.SetJointOrientation(FQuat(State.JointOrientations[Joint]), Hand, (EHandKeypoint)Joint);
+				HandTracker.SetJointPosition(FVector(State.JointPositions[Joint]), Hand, (EHandKeypoint)Joint);
+				HandTracker.SetJointRadius(State.JointRadii[Joint], Hand, (EHandKeypoint)Joint);
+			}
+		}
+
+		if (State.bHasPointerPose)
+		{
+			HandTracker.SetPointerPose(FTransform(FQuat(State.PointerOrientation), FVector(State.PointerPosition)), Hand);
+		}
+
+		if (State.bHasGripPose)
+		{
+			HandTracker.SetGripPose(FTransform(FQuat(State.GripOrientation), FVector(State.GripPosition)), Hand);
+		}
+	}
+
+	FUxtRecordedHandState MakeSweepHandState(const FVector& Position, bool bIsPinching)
+	{
+		FUxtRecordedHandState State;
+		State.bIsTracked = true;
+		State.bIsHandController = true;
+		State.bIsGrabbing = bIsPinching;
+		State.bIsSelectPressed = bIsPinching;
+		State.bHasJoints = true;
+		State.bHasPointerPose = true;
+		State.bHasGripPose = true;
+
+		for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+		{
+			State.JointPositions[Joint] = FVector3f(Position);
+			State.JointRadii[Joint] = 1.0f;
+		}
+
+		// Extend the index finger forward so that it can poke targets ahead of the hand
+		State.JointPositions[(int32)EHandKeypoint::IndexTip] = FVector3f(Position + FVector(5.0f, 0.0f, 0.0f));
+
+		State.PointerPosition = FVector3f(Position);
+		State.GripPosition = FVector3f(Position);
+		return State;
+	}
+} // namespace
+
+bool FUxtHandReplay::LoadRecording(const FString& Filename)
+{
+	return Recording.LoadFromFile(Filename);
+}
+
+void FUxtHandReplay::SetRecording(const FUxtHandRecording& InRecording)
+{
+	Recording = InRecording;
+}
+
+void FUxtHandReplay::ApplyFrame(int32 FrameIndex) const
+{
+	const FUxtRecordedFrame& Frame = Recording.Frames[FrameIndex];
+
+	FUxtTestHandTracker& HandTracker = UxtTestUtils::GetTestHandTracker();
+	ApplyHandState(HandTracker, Frame.LeftHand, EControllerHand::Left);
+	ApplyHandState(HandTracker, Frame.RightHand, EControllerHand::Right);
+}
+
+void FUxtHandReplay::Enqueue(FFrameQueue& FrameQueue, TFunction<void(int32)> OnFrameApplied) const
+{
+	// World time at which the first frame was applied, later frames are scheduled relative to it
+	TSharedRef<double> StartTime = MakeShared<double>(0.0);
+
+	double FrameTime = 0.0;
+	for (int32 FrameIndex = 0; FrameIndex < Recording.Frames.Num(); ++FrameIndex)
+	{
+		// The delta time of the first frame refers to a frame before the recording started
+		if (FrameIndex > 0)
+		{
+			FrameTime += Recording.Frames[FrameIndex].DeltaTime;
+		}
+
+		FrameQueue.Enqueue(
+			[this, &FrameQueue, FrameIndex, FrameTime, StartTime, OnFrameApplied]
+			{
+				auto ApplyRecordedFrame = [this, FrameIndex, OnFrameApplied]
+				{
+					ApplyFrame(FrameIndex);
+
+					if (OnFrameApplied)
+					{
+						OnFrameApplied(FrameIndex);
+					}
+				};
+
+				UWorld* World = UxtTestUtils::GetTestWorld();
+				if (FrameIndex == 0)
+				{
+					*StartTime = World->GetTimeSeconds();
+				}
+
+				// Hold the queue until the recorded time of the frame is reached
+				const float Delay = (float)(*StartTime + FrameTime - World->GetTimeSeconds());
+				if (Delay > 0.0f)
+				{
+					FrameQueue.Pause();
+
+					FTimerHandle Handle;
+					World->GetTimerManager().SetTimer(
+						Handle,
+						FTimerDelegate::CreateLambda(
+							[&FrameQueue, ApplyRecordedFrame]
+							{
+								ApplyRecordedFrame();
+								FrameQueue.Resume();
+							}),
+						Delay, false);
+				}
+				else
+				{
+					ApplyRecordedFrame();
+				}
+			});
+	}
+}
+
+FUxtHandRecording FUxtHandReplay::CreateSweepRecording(const FVector& Start, const FVector& End, int32 NumFrames)
+{
+	const FVector HandOffset(0.0f, 10.0f, 0.0f);
+
+	FUxtHandRecording SweepRecording;
+	SweepRecording.Frames.SetNum(NumFrames);
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+	{
+		const float Alpha = NumFrames > 1 ? (float)FrameIndex / (NumFrames - 1) : 0.0f;
+		const FVector Position = FMath::Lerp(Start, End, Alpha);
+		const bool bIsPinching = Alpha > 1.0f / 3.0f && Alpha < 2.0f / 3.0f;
+
+		FUxtRecordedFrame& Frame = SweepRecording.Frames[FrameIndex];
+		Frame.DeltaTime = 1.0f / 60.0f;
+		Frame.LeftHand = MakeSweepHandState(Position - HandOffset, bIsPinching);
+		Frame.RightHand = MakeSweepHandState(Position + HandOffset, bIsPinching);
+	}
+
+	return SweepRecording;
+}
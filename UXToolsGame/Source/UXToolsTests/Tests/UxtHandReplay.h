@@ -0,0 +1,45 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FrameQueue.h"
+
+#include "HandTracking/UxtHandRecording.h"
+
+/**
+ * Plays back a hand recording through the test hand tracker.
+ * Recorded frames are applied using a frame queue at the world time given by their recorded delta times.
+ */
+class FUxtHandReplay
+{
+public:
+	/** Load the recording from a file. Returns false if the file is not a valid recording. */
+	bool LoadRecording(const FString& Filename);
+
+	/** Use the given recording for playback. */
+	void SetRecording(const FUxtHandRecording& InRecording);
+
+	/** Get the recording used for playback. */
+	const FUxtHandRecording& GetRecording() const { return Recording; }
+
+	/** Set the test hand tracker state of both hands to the given recorded frame. */
+	void ApplyFrame(int32 FrameIndex) const;
+
+	/**
+	 * Enqueue playback of all recorded frames, following the recorded delta times.
+	 * Every frame is applied, at most one per game frame, so playback falls behind if the game runs slower than the recording.
+	 * The optional callback is called in the same frame right after each recorded frame has been applied.
+	 */
+	void Enqueue(FFrameQueue& FrameQueue, TFunction<void(int32)> OnFrameApplied = nullptr) const;
+
+	/**
+	 * Create a recording of both hands moving from start to end, side by side, pinching in the middle third of the recording.
+	 * Can be used as a default workload when no recording file is available.
+	 */
+	static FUxtHandRecording CreateSweepRecording(const FVector& Start, const FVector& End, int32 NumFrames);
+
+private:
+	FUxtHandRecording Recording;
+};
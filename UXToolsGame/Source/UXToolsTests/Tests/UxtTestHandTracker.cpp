@@ -26,14 +26,14 @@ ETrackingStatus FUxtTestHandTracker::GetTrackingStatus(EControllerHand Hand) con
 bool FUxtTestHandTracker::IsHandController(EControllerHand Hand) const
 {
 	const FUxtTestHandData& HandState = GetHandState(Hand);
-	return HandState.bIsTracked;
+	return HandState.bIsTracked && HandState.bHasJoints;
 }
 
 bool FUxtTestHandTracker::GetJointState(
 	EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
 {
 	const FUxtTestHandData& HandState = GetHandState(Hand);
-	if (HandState.bIsTracked)
+	if (HandState.bIsTracked && HandState.bHasJoints)
 	{
 		OutOrientation = HandState.JointOrientation[(uint8)Joint];
 		OutPosition = HandState.JointPosition[(uint8)Joint];
@@ -44,13 +44,38 @@ bool FUxtTestHandTracker::GetJointState(
 	return false;
 }
 
+bool FUxtTestHandTracker::GetAllJointStates(
+	EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions, TArrayView<float> OutRadii) const
+{
+	check(OutOrientations.Num() == EHandKeypointCount && OutPositions.Num() == EHandKeypointCount && OutRadii.Num() == EHandKeypointCount);
+
+	const FUxtTestHandData& HandState = GetHandState(Hand);
+	if (HandState.bIsTracked && HandState.bHasJoints)
+	{
+		FMemory::Memcpy(OutOrientations.GetData(), HandState.JointOrientation.GetData(), EHandKeypointCount * sizeof(FQuat));
+		FMemory::Memcpy(OutPositions.GetData(), HandState.JointPosition.GetData(), EHandKeypointCount * sizeof(FVector));
+		FMemory::Memcpy(OutRadii.GetData(), HandState.JointRadius.GetData(), EHandKeypointCount * sizeof(float));
+		return true;
+	}
+
+	return false;
+}
+
 bool FUxtTestHandTracker::GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
 {
 	const FUxtTestHandData& HandState = GetHandState(Hand);
-	if (HandState.bIsTracked)
+	if (HandState.bIsTracked && HandState.bHasPointerPose)
 	{
-		OutOrientation = HandState.JointOrientation[(uint8)EHandKeypoint::IndexProximal];
-		OutPosition = HandState.JointPosition[(uint8)EHandKeypoint::IndexProximal];
+		if (HandState.PointerPose.IsSet())
+		{
+			OutOrientation = HandState.PointerPose->GetRotation();
+			OutPosition = HandState.PointerPose->GetLocation();
+		}
+		else
+		{
+			OutOrientation = HandState.JointOrientation[(uint8)EHandKeypoint::IndexProximal];
+			OutPosition = HandState.JointPosition[(uint8)EHandKeypoint::IndexProximal];
+		}
 		return true;
 	}
 
@@ -60,10 +85,18 @@ bool FUxtTestHandTracker::GetPointerPose(EControllerHand Hand, FQuat& OutOrienta
 bool FUxtTestHandTracker::GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
 {
 	const FUxtTestHandData& HandState = GetHandState(Hand);
-	if (HandState.bIsTracked)
+	if (HandState.bIsTracked && HandState.bHasGripPose)
 	{
-		OutOrientation = HandState.JointOrientation[(uint8)EHandKeypoint::IndexProximal];
-		OutPosition = HandState.JointPosition[(uint8)EHandKeypoint::IndexProximal];
+		if (HandState.GripPose.IsSet())
+		{
+			OutOrientation = HandState.GripPose->GetRotation();
+			OutPosition = HandState.GripPose->GetLocation();
+		}
+		else
+		{
+			OutOrientation = HandState.JointOrientation[(uint8)EHandKeypoint::IndexProximal];
+			OutPosition = HandState.JointPosition[(uint8)EHandKeypoint::IndexProximal];
+		}
 		return true;
 	}
 
@@ -94,6 +127,52 @@ bool FUxtTestHandTracker::GetIsSelectPressed(EControllerHand Hand, bool& OutIsSe
 	return false;
 }
 
+const FUxtHandFrame& FUxtTestHandTracker::GetHandFrame(EControllerHand Hand) const
+{
+	return HandFrameCache.GetHandFrame(*this, Hand);
+}
+
+const FUxtHandHistory& FUxtTestHandTracker::GetHandHistory(EControllerHand Hand) const
+{
+	return HandFrameCache.GetHandHistory(*this, Hand);
+}
+
+void FUxtTestHandTracker::SetPredictionSettings(const FUxtHandPredictionSettings& Settings)
+{
+	HandFrameCache.SetPredictionSettings(Settings);
+}
+
+const FUxtHandPredictionSettings& FUxtTestHandTracker::GetPredictionSettings() const
+{
+	return HandFrameCache.GetPredictionSettings();
+}
+
+bool FUxtTestHandTracker::GetPredictedJointState(
+	EControllerHand Hand, EHandKeypoint Joint, double TargetTime, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
+{
+	return HandFrameCache.GetPredictedJointState(*this, Hand, Joint, TargetTime, OutOrientation, OutPosition, OutRadius);
+}
+
+bool FUxtTestHandTracker::GetPredictedPointerPose(
+	EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return HandFrameCache.GetPredictedPointerPose(*this, Hand, TargetTime, OutOrientation, OutPosition);
+}
+
+bool FUxtTestHandTracker::GetPredictedGripPose(EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return HandFrameCache.GetPredictedGripPose(*this, Hand, TargetTime, OutOrientation, OutPosition);
+}
+
+void FUxtTestHandTracker::Reset()
+{
+	LeftHandData = FUxtTestHandData();
+	RightHandData = FUxtTestHandData();
+
+	HandFrameCache.SetPredictionSettings(FUxtHandPredictionSettings());
+	HandFrameCache.Reset();
+}
+
 const FUxtTestHandData& FUxtTestHandTracker::GetHandState(EControllerHand Hand) const
 {
 	switch (Hand)
@@ -108,6 +187,9 @@ const FUxtTestHandData& FUxtTestHandTracker::GetHandState(EControllerHand Hand)
 
 void FUxtTestHandTracker::SetTracked(bool bIsTracked, EControllerHand Hand)
 {
+	// Hand frames may have been captured already in this frame
+	HandFrameCache.Invalidate();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -123,6 +205,63 @@ void FUxtTestHandTracker::SetTracked(bool bIsTracked, EControllerHand Hand)
 	}
 }
 
+void FUxtTestHandTracker::SetJointsAvailable(bool bHasJoints, EControllerHand Hand)
+{
+	HandFrameCache.Invalidate();
+
+	switch (Hand)
+	{
+	case EControllerHand::Left:
+		LeftHandData.bHasJoints = bHasJoints;
+		break;
+	case EControllerHand::Right:
+		RightHandData.bHasJoints = bHasJoints;
+		break;
+	case EControllerHand::AnyHand:
+		LeftHandData.bHasJoints = bHasJoints;
+		RightHandData.bHasJoints = bHasJoints;
+		break;
+	}
+}
+
+void FUxtTestHandTracker::SetPointerPoseAvailable(bool bHasPointerPose, EControllerHand Hand)
+{
+	HandFrameCache.Invalidate();
+
+	switch (Hand)
+	{
+	case EControllerHand::Left:
+		LeftHandData.bHasPointerPose = bHasPointerPose;
+		break;
+	case EControllerHand::Right:
+		RightHandData.bHasPointerPose = bHasPointerPose;
+		break;
+	case EControllerHand::AnyHand:
+		LeftHandData.bHasPointerPose = bHasPointerPose;
+		RightHandData.bHasPointerPose = bHasPointerPose;
+		break;
+	}
+}
+
+void FUxtTestHandTracker::SetGripPoseAvailable(bool bHasGripPose, EControllerHand Hand)
+{
+	HandFrameCache.Invalidate();
+
+	switch (Hand)
+	{
+	case EControllerHand::Left:
+		LeftHandData.bHasGripPose = bHasGripPose;
+		break;
+	case EControllerHand::Right:
+		RightHandData.bHasGripPose = bHasGripPose;
+		break;
+	case EControllerHand::AnyHand:
+		LeftHandData.bHasGripPose = bHasGripPose;
+		RightHandData.bHasGripPose = bHasGripPose;
+		break;
+	}
+}
+
 void FUxtTestHandTracker::SetGrabbing(bool bIsGrabbing, EControllerHand Hand)
 {
 	switch (Hand)
@@ -159,6 +298,8 @@ void FUxtTestHandTracker::SetSelectPressed(bool bIsSelectPressed, EControllerHan
 
 void FUxtTestHandTracker::SetJointPosition(const FVector& Position, EControllerHand Hand, EHandKeypoint Joint)
 {
+	HandFrameCache.Invalidate();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -176,6 +317,8 @@ void FUxtTestHandTracker::SetJointPosition(const FVector& Position, EControllerH
 
 void FUxtTestHandTracker::SetAllJointPositions(const FVector& Position, EControllerHand Hand)
 {
+	HandFrameCache.Invalidate();
+
 	const int32 NumKeypoints = EHandKeypointCount;
 	switch (Hand)
 	{
@@ -203,6 +346,8 @@ void FUxtTestHandTracker::SetAllJointPositions(const FVector& Position, EControl
 
 void FUxtTestHandTracker::SetJointOrientation(const FQuat& Orientation, EControllerHand Hand, EHandKeypoint Joint)
 {
+	HandFrameCache.Invalidate();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -220,6 +365,8 @@ void FUxtTestHandTracker::SetJointOrientation(const FQuat& Orientation, EControl
 
 void FUxtTestHandTracker::SetAllJointOrientations(const FQuat& Orientation, EControllerHand Hand)
 {
+	HandFrameCache.Invalidate();
+
 	const int32 NumKeypoints = EHandKeypointCount;
 	switch (Hand)
 	{
@@ -247,6 +394,8 @@ void FUxtTestHandTracker::SetAllJointOrientations(const FQuat& Orientation, ECon
 
 void FUxtTestHandTracker::SetJointRadius(float Radius, EControllerHand Hand, EHandKeypoint Joint)
 {
+	HandFrameCache.Invalidate();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -264,6 +413,8 @@ void FUxtTestHandTracker::SetJointRadius(float Radius, EControllerHand Hand, EHa
 
 void FUxtTestHandTracker::SetAllJointRadii(float Radius, EControllerHand Hand)
 {
+	HandFrameCache.Invalidate();
+
 	const int32 NumKeypoints = EHandKeypointCount;
 	switch (Hand)
 	{
@@ -288,3 +439,41 @@ void FUxtTestHandTracker::SetAllJointRadii(float Radius, EControllerHand Hand)
 		break;
 	}
 }
+
+void FUxtTestHandTracker::SetPointerPose(const FTransform& Pose, EControllerHand Hand)
+{
+	HandFrameCache.Invalidate();
+
+	switch (Hand)
+	{
+	case EControllerHand::Left:
+		LeftHandData.PointerPose = Pose;
+		break;
+	case EControllerHand::Right:
+		RightHandData.PointerPose = Pose;
+		break;
+	case EControllerHand::AnyHand:
+		LeftHandData.PointerPose = Pose;
+		RightHandData.PointerPose = Pose;
+		break;
+	}
+}
+
+void FUxtTestHandTracker::SetGripPose(const FTransform& Pose, EControllerHand Hand)
+{
+	HandFrameCache.Invalidate();
+
+	switch (Hand)
+	{
+	case EControllerHand::Left:
+		LeftHandData.GripPose = Pose;
+		break;
+	case EControllerHand::Right:
+		RightHandData.GripPose = Pose;
+		break;
+	case EControllerHand::AnyHand:
+		LeftHandData.GripPose = Pose;
+		RightHandData.GripPose = Pose;
+		break;
+	}
+}
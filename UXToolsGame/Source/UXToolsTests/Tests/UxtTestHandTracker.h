@@ -6,6 +6,7 @@
 #include "InputCoreTypes.h"
 
 #include "HandTracking/IUxtHandTracker.h"
+#include "HandTracking/UxtHandFrameCache.h"
 
 struct FUxtTestHandData
 {
@@ -14,6 +15,15 @@ struct FUxtTestHandData
 	/** Enable tracking of this hand. */
 	bool bIsTracked = true;
 
+	/** Report joints while tracked. Disable to emulate a motion controller. */
+	bool bHasJoints = true;
+
+	/** Report the pointer pose while tracked. */
+	bool bHasPointerPose = true;
+
+	/** Report the grip pose while tracked. */
+	bool bHasGripPose = true;
+
 	/** Position for each joint. */
 	TArray<FVector> JointPosition;
 
@@ -28,6 +38,12 @@ struct FUxtTestHandData
 
 	/** Enable select state. */
 	bool bIsSelectPressed = false;
+
+	/** Pointer pose, the index proximal joint is used if not set. */
+	TOptional<FTransform> PointerPose;
+
+	/** Grip pose, the index proximal joint is used if not set. */
+	TOptional<FTransform> GripPose;
 };
 
 /** WMR implementation of the hand tracker interface */
@@ -41,10 +57,27 @@ public:
 	virtual bool IsHandController(EControllerHand Hand) const override;
 	virtual bool GetJointState(
 		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const override;
+	virtual bool GetAllJointStates(
+		EControllerHand Hand, TArrayView<FQuat> OutOrientations, TArrayView<FVector> OutPositions,
+		TArrayView<float> OutRadii) const override;
 	virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
 	virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
 	virtual bool GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const override;
 	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override;
+	virtual const FUxtHandFrame& GetHandFrame(EControllerHand Hand) const override;
+	virtual const FUxtHandHistory& GetHandHistory(EControllerHand Hand) const override;
+	virtual void SetPredictionSettings(const FUxtHandPredictionSettings& Settings) override;
+	virtual const FUxtHandPredictionSettings& GetPredictionSettings() const override;
+	virtual bool GetPredictedJointState(
+		EControllerHand Hand, EHandKeypoint Joint, double TargetTime, FQuat& OutOrientation, FVector& OutPosition,
+		float& OutRadius) const override;
+	virtual bool GetPredictedPointerPose(
+		EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetPredictedGripPose(
+		EControllerHand Hand, double TargetTime, FQuat& OutOrientation, FVector& OutPosition) const override;
+
+	/** Restore the default state of both hands and discard the hand histories. */
+	void Reset();
 
 	/** Get current hand state data. */
 	const FUxtTestHandData& GetHandState(EControllerHand Hand) const;
@@ -52,6 +85,15 @@ public:
 	/** Set tracking status. */
 	void SetTracked(bool bIsTracked, EControllerHand Hand = EControllerHand::AnyHand);
 
+	/** Set whether joints are reported while tracked. */
+	void SetJointsAvailable(bool bHasJoints, EControllerHand Hand = EControllerHand::AnyHand);
+
+	/** Set whether the pointer pose is reported while tracked. */
+	void SetPointerPoseAvailable(bool bHasPointerPose, EControllerHand Hand = EControllerHand::AnyHand);
+
+	/** Set whether the grip pose is reported while tracked. */
+	void SetGripPoseAvailable(bool bHasGripPose, EControllerHand Hand = EControllerHand::AnyHand);
+
 	/** Set grab state. */
 	void SetGrabbing(bool bIsGrabbing, EControllerHand Hand = EControllerHand::AnyHand);
 
@@ -76,10 +118,19 @@ public:
 	/** Set radius for all joints of the hand. */
 	void SetAllJointRadii(float Radius, EControllerHand Hand = EControllerHand::AnyHand);
 
+	/** Set the pointer pose, overriding the default of using the index proximal joint. */
+	void SetPointerPose(const FTransform& Pose, EControllerHand Hand = EControllerHand::AnyHand);
+
+	/** Set the grip pose, overriding the default of using the index proximal joint. */
+	void SetGripPose(const FTransform& Pose, EControllerHand Hand = EControllerHand::AnyHand);
+
 private:
 	/** Data for the left hand. */
 	FUxtTestHandData LeftHandData;
 
 	/** Data for the right hand. */
 	FUxtTestHandData RightHandData;
+
+	/** Hand frames and histories captured from the hand data. */
+	mutable FUxtHandFrameCache HandFrameCache;
 };
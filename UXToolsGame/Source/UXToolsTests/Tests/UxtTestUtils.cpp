@@ -129,7 +129,7 @@ void UxtTestUtils::EnableTestInputSystem()
 	IModularFeatures::Get().RegisterModularFeature(IUxtHandTracker::GetModularFeatureName(), &TestHandTracker);
 
 	// Reset test hand tracker defaults
-	TestHandTracker = FUxtTestHandTracker();
+	TestHandTracker.Reset();
 
 	// Enable the test head tracker and reset its position
 	UUxtFunctionLibrary::bUseTestData = true;